@@ -1,10 +1,15 @@
-#define SPLIT_MODS_ENABLE
-#define SPLIT_LED_STATE_ENABLE
-#define SPLIT_LAYER_STATE_ENABLE
-#define SPLIT_OLED_ENABLE
-#define WPM_LAUNCH_CONTROL
+#define SPLIT_TRANSACTION_IDS_USER OLED_SYNC_STATUS
 
-#define CMK 1
-#define NUM 2
-#define SYM 3
-#define FNC 4
+// Layer numbers and masks named after the layers of ethanharstad.json
+#include "keymap/ethanharstad-layer-ids.h"
+
+// Font of only the glyphs the userspace writes, cut from "oled/oledfont.c"
+// rather than QMK's default font by "oled/fontsubset.c", unless the build
+// names its own font. Static text is drawn from the
+// bitmaps of "oled/oled-text.h" and needs no glyphs.
+#ifndef OLED_FONT_H
+#define OLED_FONT_H "oled/oledfont-subset.c"
+#define OLED_FONT_SUBSET
+#define OLED_FONT_END 0
+#define OLED_TEXT_RAW
+#endif
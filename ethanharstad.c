@@ -1 +1,45 @@
 #include QMK_KEYBOARD_H
+
+#ifdef OLED_ENABLE
+#include "oled/oled-profile.h"
+#include "oled/oled-sprite.h"
+#include "oled/oled-sync.h"
+#include "oled/oled-typing.h"
+
+// Status for the secondary OLED from "oled/oled-sync.c"
+void keyboard_post_init_user(void)
+{
+    oled_sync_init();
+}
+
+// Status for the secondary OLED and scans for "oled/oled-profile.c"
+void housekeeping_task_user(void)
+{
+    oled_sync_task();
+    oled_profile_scan();
+}
+
+// Feed the OLED invalidation hooks in "oled/oled-sprite.c"
+layer_state_t layer_state_set_user(layer_state_t state)
+{
+    oled_invalidate(OLED_INVALID_LAYER);
+    return state;
+}
+
+bool led_update_user(led_t led_state)
+{
+    oled_invalidate(OLED_INVALID_LED);
+    return true;
+}
+
+bool process_record_user(uint16_t keycode, keyrecord_t *record)
+{
+    if (record->event.pressed)
+    {
+        oled_tap_timer = timer_read32();
+        typing_record(oled_tap_timer);
+        oled_invalidate(OLED_INVALID_TAP);
+    }
+    return true;
+}
+#endif
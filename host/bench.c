@@ -0,0 +1,582 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Host round-trip test and benchmark for the OLED frame decoders.
+   Every shipped bongocat animation is played through the sprite engine
+   into the mocked OLED buffer and compared with the source frames in
+   "oled/assets/", then timed to report decode throughput. All source
+   frames, including Luna and Felix, are then re-encoded by "rle.c" with
+   RLE only, LZ only and the smallest codec per frame to compare flash
+   against decode cost. PROGMEM reads per frame stand in for AVR cycles.
+   Luna display assets are last drawn and flushed both in software
+   rotated OLED_ROTATION_270 and pre-rotated in OLED_ROTATION_180, with
+   the 8x8 tiles transposed by the driver counted per frame. Bulk run
+   and span writes are timed against per-byte writes. Finally a
+   minute of matrix scans counts rendered and skipped OLED passes and
+   the status bytes per second sent to the secondary half, with render
+   times per state when built with "oled/oled-profile.c" and
+        -DOLED_PROFILE -DOLED_PROFILE_US=host_clock_us
+   Built with -DOLED_DECODE_BUDGET=n, frames are decoded over as many
+   passes as the budget needs and the most passes a frame took is shown,
+   along with the tap frames shown over ten seconds of passes paced at
+   OLED_UPDATE_INTERVAL, 50 ms as on split boards unless defined.
+
+   Build and run from the userspace root:
+        cc -O2 -Ihost -DQMK_KEYBOARD_H='"qmk.h"' \
+            -DSPLIT_TRANSACTION_IDS_USER=OLED_SYNC_STATUS \
+            -o bench host/bench.c host/qmk.c host/pbm.c oled/oled-codec.c \
+            oled/oled-sprite.c oled/oled-sync.c oled/oled-typing.c
+        ./bench [iterations]
+   Exits non-zero if any decoded frame differs from its source.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "pbm.h"
+#include "../oled/oled-bongocat.c"
+#include "../oled/oled-profile.h"
+#include "../oled/oled-sync.h"
+#include "../oled/oled-typing.h"
+#include "transactions.h"
+
+#define RLE_NO_MAIN
+#include "../oled/rle.c"
+
+#define FRAME_SIZE (128 * 4)
+
+// Secondary OLED is not exercised here
+void render_mod_status(void) {}
+
+typedef struct
+{
+    char const *name;
+    unsigned char const *frames;
+    char const *source;
+    uint8_t const *sequence;
+    uint16_t tap_age;
+    bool left;
+} shipped_t;
+
+// Playback order of the source frames, as encoded by "rle.c"
+static uint8_t const idle_sequence[] = {0, 0, 1, 2, 3};
+static uint8_t const paws_sequence[] = {0};
+static uint8_t const tap_sequence[] = {0, 1};
+
+// Key press age before every frame that buckets typing for the state
+#define IDLE_AGE (TYPING_IDLE_TIME * 2)
+#define SLOWING_AGE (TYPING_SLOW_INTERVAL + FRAME_DURATION / 2)
+
+static shipped_t const animations[] = {
+    {"idle", idle, "oled/assets/bongocat-idle.pbm", idle_sequence, IDLE_AGE, false},
+    {"paws", paws, "oled/assets/bongocat-paws.pbm", paws_sequence, SLOWING_AGE, false},
+    {"tap", tap, "oled/assets/bongocat-tap.pbm", tap_sequence, 0, false},
+    {"left_idle", idle, "oled/assets/bongocat-idle.pbm", idle_sequence, IDLE_AGE, true},
+    {"left_paws", paws, "oled/assets/bongocat-paws.pbm", paws_sequence, SLOWING_AGE, true},
+    {"left_tap", tap, "oled/assets/bongocat-tap.pbm", tap_sequence, 0, true},
+};
+#define ANIMATIONS (sizeof(animations) / sizeof(animations[0]))
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// Step the sprite engine one frame with a key pressed at an age that
+// enters the state of anim
+#ifdef OLED_DECODE_BUDGET
+static uint32_t max_passes = 0;
+#endif
+
+static void show_frame(shipped_t const *anim)
+{
+    host_timer += FRAME_DURATION + 1;
+    oled_tap_timer = host_timer - anim->tap_age;
+    typing_record(oled_tap_timer);
+    oled_task_user();
+#ifdef OLED_DECODE_BUDGET
+    // A frame over budget renders again every pass until it is complete
+    extern uint32_t oled_renders;
+    uint32_t passes = 1;
+    for (uint32_t renders = 0; renders != oled_renders; ++passes)
+    {
+        renders = oled_renders;
+        oled_task_user();
+    }
+    max_passes = passes - 1 > max_passes ? passes - 1 : max_passes;
+#endif
+}
+
+#ifdef OLED_DECODE_BUDGET
+#ifndef OLED_UPDATE_INTERVAL
+#define OLED_UPDATE_INTERVAL 50
+#endif
+
+// Type for ten seconds with a pass every OLED_UPDATE_INTERVAL, as split
+// boards run 'oled_task_user()', and count the tap frames completed.
+// Blocks are only marked dirty once a frame is complete.
+static void paced_frames(void)
+{
+    uint32_t const period = 10000;
+    uint32_t frames = 0;
+
+    typing_reset();
+    host_keyboard_left = false;
+    for (uint32_t ms = 0; ms < period; ms += OLED_UPDATE_INTERVAL)
+    {
+        host_timer += OLED_UPDATE_INTERVAL;
+        oled_tap_timer = host_timer;
+        typing_record(oled_tap_timer);
+        oled_invalidate(OLED_INVALID_TAP);
+        oled_dirty = 0;
+        oled_task_user();
+        frames += oled_dirty != 0;
+    }
+    printf("Passes every %u ms showed %u of %u frames in %u s\n", OLED_UPDATE_INTERVAL, frames,
+           period / FRAME_DURATION, period / 1000);
+}
+#endif
+
+static uint8_t frame_count(shipped_t const *anim)
+{
+    return anim->frames[1];
+}
+
+// Compare the OLED buffer with a source frame, mirrored for the left cat
+static int compare_frame(shipped_t const *anim, image_t const *image, uint8_t const step)
+{
+    unsigned char source[FRAME_SIZE];
+    int errors = 0;
+
+    image_frame(image, anim->sequence[step % frame_count(anim)], 128, 32, source);
+
+    for (uint16_t i = 0; i < FRAME_SIZE; ++i)
+    {
+        uint8_t expected = source[anim->left ? i ^ 0x7f : i];
+        if (oled_buffer[i] != expected)
+        {
+            if (!errors)
+            {
+                printf("  %s frame %u: byte %u is 0x%02x, expected 0x%02x\n",
+                       anim->name, step, i, oled_buffer[i], expected);
+            }
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+// Container length is the last entry of the offset table
+static uint16_t container_size(unsigned char const *container)
+{
+    unsigned char const *end = container + OLED_ANIM_HEADER + container[1] * 2;
+    return end[0] | end[1] << 8;
+}
+
+typedef struct
+{
+    char const *spec;
+    int width;
+    int height;
+    uint16_t start;
+} source_t;
+
+// Every shipped frame, Luna and Felix sit below the logo on the
+// rotated 32 pixel wide display
+static source_t const sources[] = {
+    {"idle=oled/assets/bongocat-idle.pbm@0,0,1,2,3", 128, 32, 0},
+    {"paws=oled/assets/bongocat-paws.pbm", 128, 32, 0},
+    {"tap=oled/assets/bongocat-tap.pbm", 128, 32, 0},
+    {"luna=oled/assets/luna.pbm", 32, 24, 8 * 32},
+    {"felix=oled/assets/felix.pbm", 32, 24, 8 * 32},
+};
+#define SOURCES (sizeof(sources) / sizeof(sources[0]))
+
+static int const codec_sets[] = {
+    CODEC_BIT(OLED_CODEC_RLE) | CODEC_BIT(OLED_CODEC_DELTA),
+    CODEC_BIT(OLED_CODEC_LZ),
+    CODECS_ALL,
+};
+static char const *const codec_set_names[] = {"rle", "lz", "best"};
+#define CODEC_SETS (sizeof(codec_sets) / sizeof(codec_sets[0]))
+
+// Encode every source with each codec set, check the decode and report
+// flash, PROGMEM reads and time per frame
+static int compare_codecs(long const iterations)
+{
+    static animation_t anim;
+    static unsigned char container[0x10000];
+    int failures = 0;
+    uint32_t total_size[CODEC_SETS] = {0};
+
+    printf("\n%-10s %-5s %6s %10s %10s\n", "source", "codec", "flash", "reads", "us/frame");
+    for (uint8_t s = 0; s < SOURCES; ++s)
+    {
+        frame_width = sources[s].width;
+        frame_height = sources[s].height;
+        frame_size = frame_width * frame_height / 8;
+        rotate = 0;
+        if (load_animation(sources[s].spec, &anim))
+        {
+            return 1;
+        }
+
+        for (uint8_t c = 0; c < CODEC_SETS; ++c)
+        {
+            report_t report = {0};
+            anim.codecs = codec_sets[c];
+            size_t size = anim_encode(container, &anim, &report);
+
+            // Frames are decoded in order so deltas apply to their keyframe
+            memset(oled_buffer, 0xa5, sizeof(oled_buffer));
+            host_pgm_reads = 0;
+            for (int f = 0; f < anim.count; ++f)
+            {
+                decode_frame(container, f, sources[s].start, 0);
+                if (memcmp(oled_buffer + sources[s].start, anim.frames[f], frame_size))
+                {
+                    printf("  %s %s frame %d does not round trip\n", anim.name, codec_set_names[c], f);
+                    ++failures;
+                }
+            }
+            double reads = (double)host_pgm_reads / anim.count;
+
+            double start = now_us();
+            for (long n = 0; n < iterations; ++n)
+            {
+                for (int f = 0; f < anim.count; ++f)
+                {
+                    decode_frame(container, f, sources[s].start, 0);
+                }
+            }
+            double elapsed = now_us() - start;
+
+            total_size[c] += size;
+            printf("%-10s %-5s %6zu %10.1f %10.3f\n", anim.name, codec_set_names[c], size, reads,
+                   elapsed / ((double)iterations * anim.count));
+        }
+    }
+    for (uint8_t c = 0; c < CODEC_SETS; ++c)
+    {
+        printf("Total %s flash: %u bytes\n", codec_set_names[c], total_size[c]);
+    }
+    return failures;
+}
+
+typedef struct
+{
+    char const *spec;
+    int width;
+    int height;
+    uint16_t start;
+    uint16_t native_start;
+} rotated_t;
+
+// Luna display assets, drawn in OLED_ROTATION_270 as shipped or
+// pre-rotated by "rle.c -r" in OLED_ROTATION_180
+static rotated_t const rotated[] = {
+    {"logo=oled/assets/luna-logo.pbm", 32, 32, 0, 0},
+    {"luna=oled/assets/luna.pbm", 32, 24, 8 * 32, 64},
+    {"felix=oled/assets/felix.pbm", 32, 24, 8 * 32, 64},
+};
+#define ROTATED (sizeof(rotated) / sizeof(rotated[0]))
+
+// Decode and flush every frame of a source in one display mode, keeping
+// the panel image of each frame. Returns the number of frames.
+static int render_rotated(rotated_t const *source, bool const native, long const iterations,
+                          unsigned char panels[][OLED_MATRIX_SIZE])
+{
+    static animation_t anim;
+    static unsigned char container[0x10000];
+    report_t report = {0};
+
+    frame_width = source->width;
+    frame_height = source->height;
+    frame_size = frame_width * frame_height / 8;
+    rotate = native;
+    if (load_animation(source->spec, &anim))
+    {
+        exit(1);
+    }
+    anim.codecs = CODEC_BIT(OLED_CODEC_RLE) | CODEC_BIT(OLED_CODEC_LZ);
+    size_t const size = anim_encode(container, &anim, &report);
+
+    uint16_t const start = native ? source->native_start : source->start;
+    host_oled_rotation = native ? OLED_ROTATION_180 : OLED_ROTATION_270;
+    memset(oled_buffer, 0, sizeof(oled_buffer));
+    memset(host_oled_panel, 0, sizeof(host_oled_panel));
+    oled_dirty = 0;
+    for (int f = 0; f < anim.count; ++f)
+    {
+        decode_frame(container, f, start, 0);
+        host_oled_render();
+        memcpy(panels[f], host_oled_panel, OLED_MATRIX_SIZE);
+    }
+
+    host_oled_rotated_tiles = 0;
+    double begin = now_us();
+    for (long n = 0; n < iterations; ++n)
+    {
+        for (int f = 0; f < anim.count; ++f)
+        {
+            decode_frame(container, f, start, 0);
+            host_oled_render();
+        }
+    }
+    double const elapsed = now_us() - begin;
+    double const frames = (double)iterations * anim.count;
+
+    printf("%-10s %-8s %6zu %10.1f %10.3f\n", anim.name, native ? "native" : "rot270", size,
+           host_oled_rotated_tiles / frames, elapsed / frames);
+    return anim.count;
+}
+
+// Compare decode and flush cost of software rotated and pre-rotated
+// assets, checking both light up the same panel pixels
+static int compare_rotation(long const iterations)
+{
+    static unsigned char shipped[MAX_FRAMES][OLED_MATRIX_SIZE];
+    static unsigned char native[MAX_FRAMES][OLED_MATRIX_SIZE];
+    int failures = 0;
+
+    printf("\n%-10s %-8s %6s %10s %10s\n", "source", "mode", "flash", "tiles", "us/frame");
+    for (uint8_t s = 0; s < ROTATED; ++s)
+    {
+        int const count = render_rotated(&rotated[s], false, iterations, shipped);
+        render_rotated(&rotated[s], true, iterations, native);
+        for (int f = 0; f < count; ++f)
+        {
+            if (memcmp(shipped[f], native[f], OLED_MATRIX_SIZE))
+            {
+                printf("  %s frame %d differs when pre-rotated\n", rotated[s].spec, f);
+                ++failures;
+            }
+        }
+    }
+    host_oled_rotation = OLED_ROTATION_0;
+    return failures;
+}
+
+// Write the whole buffer as length byte runs or PROGMEM spans, per
+// byte with 'oled_write_raw_byte()' or in bulk, alternating values so
+// every byte changes. Returns the time in us.
+static double write_buffer(uint16_t const length, bool const span, bool const bulk, long const iterations)
+{
+    static unsigned char pattern[2][OLED_MATRIX_SIZE];
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; ++i)
+    {
+        pattern[0][i] = i * 37;
+        pattern[1][i] = ~pattern[0][i];
+    }
+
+    double const start = now_us();
+    for (long n = 0; n < iterations; ++n)
+    {
+        uint8_t const value = n & 1 ? 0xaa : 0x55;
+        unsigned char const *data = pattern[n & 1];
+        for (uint16_t at = 0; at < OLED_MATRIX_SIZE; at += length)
+        {
+            uint16_t const count = OLED_MATRIX_SIZE - at < length ? OLED_MATRIX_SIZE - at : length;
+            if (bulk)
+            {
+                span ? oled_write_span_P(at, data + at, count) : oled_write_run(at, value, count);
+                continue;
+            }
+            for (uint16_t i = at; i < at + count; ++i)
+            {
+                oled_write_raw_byte(span ? pgm_read_byte(data + i) : value, i);
+            }
+        }
+    }
+    return now_us() - start;
+}
+
+// Compare bulk run and span writes with per-byte writes, checking both
+// leave the same buffer and dirty blocks when started from the same one.
+// Returns the number of mismatches.
+static int compare_writes(long const iterations)
+{
+    uint16_t const lengths[] = {8, 32, 127};
+    int failures = 0;
+
+    printf("\n%-10s %6s %10s %10s %8s\n", "write", "length", "byte/us", "bulk/us", "speedup");
+    for (uint8_t span = 0; span < 2; ++span)
+    {
+        for (uint8_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); ++l)
+        {
+            uint8_t expected[OLED_MATRIX_SIZE];
+            memset(oled_buffer, 0, sizeof(oled_buffer));
+            oled_dirty = 0;
+            double const bytes = write_buffer(lengths[l], span, false, iterations);
+            memcpy(expected, oled_buffer, sizeof(expected));
+            OLED_BLOCK_TYPE const dirty = oled_dirty;
+
+            memset(oled_buffer, 0, sizeof(oled_buffer));
+            oled_dirty = 0;
+            double const bulk = write_buffer(lengths[l], span, true, iterations);
+            if (memcmp(expected, oled_buffer, sizeof(expected)) || dirty != oled_dirty)
+            {
+                printf("  %s of %u bytes differ when written in bulk\n", span ? "spans" : "runs", lengths[l]);
+                ++failures;
+            }
+
+            double const total = (double)iterations * OLED_MATRIX_SIZE;
+            printf("%-10s %6u %10.1f %10.1f %7.2fx\n", span ? "span" : "run", lengths[l], total / bytes,
+                   total / bulk, bytes / bulk);
+        }
+    }
+    oled_dirty = 0;
+    return failures;
+}
+
+#ifdef OLED_PROFILE
+static void print_timing(char const *name, oled_timing_t const *timing)
+{
+    if (timing->count)
+    {
+        printf("  %s: %u renders, min/avg/max %u/%u/%u us\n", name, timing->count, timing->min,
+               timing->total / timing->count, timing->max);
+    }
+}
+#endif
+
+// Scan one minute at 1 kHz on each half, typing a key every 150 ms for
+// the first ten seconds and changing layer and modifiers once
+static void count_renders(void)
+{
+    printf("\n%-10s %10s %10s %10s\n", "half", "rendered", "skipped", "link B/s");
+    oled_sync_init();
+    for (uint8_t half = 0; half < 2; ++half)
+    {
+        host_keyboard_master = !half;
+        oled_renders = 0;
+        oled_skipped_renders = 0;
+        host_split_bytes = 0;
+#ifdef OLED_PROFILE
+        memset(&oled_profile, 0, sizeof(oled_profile));
+#endif
+        for (uint32_t ms = 0; ms < 60000; ++ms)
+        {
+            ++host_timer;
+            if (ms < 10000 && ms % 150 == 0)
+            {
+                oled_tap_timer = host_timer;
+                typing_record(oled_tap_timer);
+                oled_invalidate(OLED_INVALID_TAP);
+            }
+            layer_state = ms >= 20000 && ms < 21000 ? 1 << 2 : 0;
+            host_mods = ms >= 30000 && ms < 30500 ? MOD_MASK_SHIFT & 0x0f : 0;
+            host_led_state.caps_lock = ms >= 40000 && ms < 45000;
+            // The primary half feeds the secondary over the link
+            host_keyboard_master = true;
+            oled_sync_task();
+            host_keyboard_master = !half;
+            if (half)
+            {
+                oled_sync_task();
+            }
+            oled_profile_scan();
+            oled_task_user();
+        }
+        printf("%-10s %10u %10u %10.1f\n", half ? "secondary" : "primary", oled_renders, oled_skipped_renders,
+               host_split_bytes / 60.0);
+#ifdef OLED_PROFILE
+        char name[] = "state 0";
+        for (uint8_t state = 0; state < OLED_PROFILE_STATES; ++state)
+        {
+            name[sizeof(name) - 2] = '0' + state;
+            print_timing(name, &oled_profile.renders[state]);
+        }
+        print_timing("later states", &oled_profile.other_states);
+        print_timing("status", &oled_profile.status);
+        printf("  %u scans/s, worst gap %u us\n", oled_profile.scan_rate, oled_profile.worst_gap);
+#endif
+    }
+    host_keyboard_master = true;
+}
+
+int main(int argc, char const *argv[])
+{
+    long const iterations = argc > 1 ? atol(argv[1]) : 20000;
+    // Codec and rotation comparisons run a tenth of the iterations
+    long const tenth = iterations >= 10 ? iterations / 10 : 1;
+    int failures = 0;
+    uint32_t total_size = 0;
+
+    printf("%-10s %6s %8s %10s %10s\n", "animation", "flash", "flushed", "bytes/us", "us/frame");
+    for (uint8_t a = 0; a < ANIMATIONS; ++a)
+    {
+        shipped_t const *anim = &animations[a];
+        uint8_t const count = frame_count(anim);
+        uint32_t flushed = 0;
+        image_t image;
+
+        if (image_load(anim->source, &image))
+        {
+            return 1;
+        }
+        host_keyboard_left = anim->left;
+        typing_reset();
+
+#ifdef OLED_SPRITE_SECONDARY
+        // Frames follow the synced timer, start the cycle on its frame 0
+        host_timer += count * FRAME_DURATION - host_timer % (count * FRAME_DURATION) - (FRAME_DURATION + 1);
+#endif
+        // Round trip one full cycle plus the wrap back to the keyframe
+        memset(oled_buffer, 0xa5, sizeof(oled_buffer));
+        for (uint8_t step = 0; step <= count; ++step)
+        {
+            // Passes that decode nothing write nothing
+            oled_frame_bytes = 0;
+            show_frame(anim);
+            flushed += step ? oled_frame_bytes : 0;
+            failures += compare_frame(anim, &image, step) != 0;
+        }
+        image_free(&image);
+
+        // Throughput over whole animation cycles
+        double start = now_us();
+        for (long n = 0; n < iterations; ++n)
+        {
+            for (uint8_t step = 0; step < count; ++step)
+            {
+                show_frame(anim);
+            }
+        }
+        double elapsed = now_us() - start;
+        double frames = (double)iterations * count;
+
+        // Left cats are mirrored at runtime from the same containers
+        total_size += anim->left ? 0 : container_size(anim->frames);
+        printf("%-10s %6u %8.1f %10.1f %10.3f\n", anim->name, anim->left ? 0 : container_size(anim->frames),
+               (double)flushed / count, frames * FRAME_SIZE / elapsed, elapsed / frames);
+    }
+    printf("Total flash: %u bytes\n", total_size);
+#ifdef OLED_DECODE_BUDGET
+    printf("Frames decoded in at most %u passes of %u bytes\n", max_passes, OLED_DECODE_BUDGET);
+    paced_frames();
+#endif
+
+    failures += compare_codecs(tenth);
+    failures += compare_rotation(tenth);
+    int const mismatches = compare_writes(iterations);
+    count_renders();
+
+    if (failures)
+    {
+        printf("FAILED: %d frames did not round trip\n", failures);
+    }
+    if (mismatches)
+    {
+        printf("FAILED: %d bulk writes differ from per-byte writes\n", mismatches);
+    }
+    if (failures || mismatches)
+    {
+        return 1;
+    }
+    printf("All frames round trip\n");
+    return 0;
+}
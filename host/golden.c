@@ -0,0 +1,261 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Golden framebuffer regression test for the OLED renderers. Every
+   frame of every state of the linked pet is drawn the way the sprite
+   engine draws it, on both primary halves with their mirror and
+   rotation, and once more per logo layer when the pet has a logo. The
+   secondary status display is drawn too. Each result is flushed to the
+   mocked panel and hashed, and hashes are compared with the checked-in
+   "host/golden/<pet>.hashes". Panels are also kept as one contact sheet
+   "host/golden/<pet>.pbm", so a mismatch prints a pixel diff against
+   the golden panel:
+     '#' lit in both   '+' only lit now   '-' only lit in golden
+
+   Build one binary per pet from the userspace root, for example Luna
+   drawn pre-rotated, and run it with the golden path prefix:
+        cc -O2 -Ihost -DQMK_KEYBOARD_H='"qmk.h"' -include config.h \
+            -DOLED_FONT_H='"../oled/oledfont.c"' -DLUNA -DOLED_PREROTATED \
+            -o golden host/golden.c host/qmk.c host/pbm.c \
+            oled/oled-luna.c oled/oled-codec.c oled/oled-icons.c
+        ./golden host/golden/luna-native
+   Golden prefixes are "bongocat" (oled-bongocat.c), "luna" (-DLUNA),
+   "felix", "luna-native" and "felix-native" (-DOLED_PREROTATED). Add
+   -u to rewrite the golden files after an intended change.
+   Exits non-zero if any panel differs.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pbm.h"
+#include "qmk.h"
+#include "../oled/oled-codec.h"
+#include "../oled/oled-sprite.h"
+
+#define MAX_CASES 256
+#define CASE_NAME 32
+
+typedef struct
+{
+    char name[CASE_NAME];
+    uint32_t hash;
+} golden_t;
+
+static golden_t cases[MAX_CASES];
+static uint8_t panels[MAX_CASES][OLED_MATRIX_SIZE];
+static int case_count = 0;
+
+// FNV-1a
+static uint32_t hash_panel(uint8_t const *panel)
+{
+    uint32_t hash = 2166136261u;
+    for (uint16_t i = 0; i < OLED_MATRIX_SIZE; ++i)
+    {
+        hash = (hash ^ panel[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// Start a case from a blank buffer in rotation, as after 'oled_clear()'
+static void begin_case(oled_rotation_t const rotation)
+{
+    host_oled_rotation = rotation;
+    oled_clear();
+    oled_set_cursor(0, 0);
+}
+
+// Flush the buffer to the panel and record it
+static void end_case(char const *name)
+{
+    if (case_count == MAX_CASES)
+    {
+        fprintf(stderr, "Too many cases, raise MAX_CASES\n");
+        exit(2);
+    }
+    host_oled_render();
+    snprintf(cases[case_count].name, CASE_NAME, "%s", name);
+    cases[case_count].hash = hash_panel(host_oled_panel);
+    memcpy(panels[case_count], host_oled_panel, OLED_MATRIX_SIZE);
+    ++case_count;
+}
+
+// Every frame of every state on one primary half. Deltas are decoded
+// in order from the keyframe as the engine plays them.
+static void render_half(char const *half, bool const left, char const *layer)
+{
+    uint8_t const mirror = left ? oled_sprite.mirror_left : 0;
+    oled_rotation_t const rotation = left ? oled_sprite.rotation_left : oled_sprite.rotation_right;
+
+    for (uint8_t s = 0; s < oled_sprite.count; ++s)
+    {
+        sprite_state_t state;
+        memcpy_P(&state, &oled_sprite.states[s], sizeof(state));
+        uint8_t const frames = pgm_read_byte(state.frames + 1);
+        for (uint8_t f = 0; f < frames; ++f)
+        {
+            char name[CASE_NAME];
+            begin_case(rotation);
+            if (oled_sprite.render)
+            {
+                oled_sprite.render();
+            }
+            for (uint8_t i = 0; i <= f; ++i)
+            {
+                decode_frame(state.frames, i, oled_sprite.start, mirror);
+            }
+            snprintf(name, sizeof(name), "%s%s/state%u/frame%u", half, layer, s, f);
+            end_case(name);
+        }
+    }
+}
+
+static void render_all(void)
+{
+    extern void render_mod_status(void);
+    char const *const layers[] = {"", "/cmk"};
+
+    // The logo only depends on the layer, and only when there is one
+    for (uint8_t l = 0; l < (oled_sprite.render ? 2 : 1); ++l)
+    {
+        // Every other layer held for the logo without CMK
+        layer_state = l ? CMK_MASK : LAYER_STATE_MASK & ~CMK_MASK;
+        host_keyboard_left = false;
+        render_half("right", false, layers[l]);
+        host_keyboard_left = true;
+        render_half("left", true, layers[l]);
+    }
+    layer_state = 0;
+    host_keyboard_left = false;
+
+    begin_case(OLED_ROTATION_270);
+    render_mod_status();
+    end_case("secondary/status");
+}
+
+// Print golden against current panel, one character per pixel
+static void print_diff(uint8_t const *golden, uint8_t const *panel)
+{
+    for (uint8_t y = 0; y < OLED_DISPLAY_HEIGHT; ++y)
+    {
+        char line[OLED_DISPLAY_WIDTH + 1];
+        for (uint8_t x = 0; x < OLED_DISPLAY_WIDTH; ++x)
+        {
+            uint16_t const index = y / 8 * OLED_DISPLAY_WIDTH + x;
+            bool const was = golden[index] >> (y % 8) & 1;
+            bool const is = panel[index] >> (y % 8) & 1;
+            line[x] = was && is ? '#' : is ? '+' : was ? '-' : '.';
+        }
+        line[OLED_DISPLAY_WIDTH] = 0;
+        printf("    %s\n", line);
+    }
+}
+
+static int write_golden(char const *prefix)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s.hashes", prefix);
+    FILE *file = fopen(path, "w");
+    if (!file)
+    {
+        perror(path);
+        return 1;
+    }
+    fprintf(file, "# Generated by \"host/golden.c -u\", panel hashes of \"%s.pbm\"\n", prefix);
+    for (int i = 0; i < case_count; ++i)
+    {
+        fprintf(file, "%s %08x\n", cases[i].name, cases[i].hash);
+    }
+    fclose(file);
+
+    snprintf(path, sizeof(path), "%s.pbm", prefix);
+    if (image_save_pages(path, panels[0], OLED_DISPLAY_WIDTH, OLED_DISPLAY_HEIGHT * case_count))
+    {
+        return 1;
+    }
+    printf("%d panels written to %s.hashes and %s.pbm\n", case_count, prefix, prefix);
+    return 0;
+}
+
+static int check_golden(char const *prefix)
+{
+    char path[256];
+    snprintf(path, sizeof(path), "%s.hashes", prefix);
+    FILE *file = fopen(path, "r");
+    if (!file)
+    {
+        perror(path);
+        return 1;
+    }
+
+    image_t sheet = {0};
+    snprintf(path, sizeof(path), "%s.pbm", prefix);
+    bool const have_sheet = !image_load(path, &sheet);
+
+    char line[128];
+    int failures = 0;
+    int checked = 0;
+    int index = 0;
+    while (fgets(line, sizeof(line), file))
+    {
+        char name[CASE_NAME];
+        unsigned hash;
+        if (line[0] == '#' || sscanf(line, "%31s %x", name, &hash) != 2)
+        {
+            continue;
+        }
+
+        int i = 0;
+        while (i < case_count && strcmp(cases[i].name, name))
+        {
+            ++i;
+        }
+        if (i == case_count)
+        {
+            printf("  %s: no longer rendered\n", name);
+            ++failures;
+        }
+        else if (cases[i].hash != hash)
+        {
+            printf("  %s: hash %08x, golden %08x\n", name, cases[i].hash, hash);
+            if (have_sheet && index < image_frames(&sheet, OLED_DISPLAY_WIDTH, OLED_DISPLAY_HEIGHT))
+            {
+                uint8_t golden[OLED_MATRIX_SIZE];
+                image_frame(&sheet, index, OLED_DISPLAY_WIDTH, OLED_DISPLAY_HEIGHT, golden);
+                print_diff(golden, panels[i]);
+            }
+            ++failures;
+        }
+        ++checked;
+        ++index;
+    }
+    fclose(file);
+    image_free(&sheet);
+
+    if (checked != case_count)
+    {
+        printf("  %d panels rendered, %d golden\n", case_count, checked);
+        ++failures;
+    }
+    if (failures)
+    {
+        printf("FAILED: %d of %d panels differ from %s\n", failures, case_count, prefix);
+        return 1;
+    }
+    printf("All %d panels match %s\n", case_count, prefix);
+    return 0;
+}
+
+int main(int argc, char const *argv[])
+{
+    bool const update = argc == 3 && !strcmp(argv[1], "-u");
+    if (argc != 2 && !update)
+    {
+        fprintf(stderr, "Usage: %s [-u] golden-prefix\n", argv[0]);
+        return 2;
+    }
+
+    render_all();
+    return update ? write_golden(argv[2]) : check_golden(argv[1]);
+}
@@ -0,0 +1,120 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Keycodes of the userspace keymap with their QMK values, enough to
+   compile the generated keymap layers on the host. HOST_KEYCODES(X)
+   expands X(name, value) once per keycode, for the enum and for
+   'host_keycode()' name lookups.
+ */
+
+#pragma once
+
+#define QK_LSFT 0x0200
+#define QK_MOMENTARY 0x5220
+
+#define LSFT(kc) (QK_LSFT | (kc))
+#define MO(layer) (QK_MOMENTARY | ((layer)&0x1F))
+
+#define HOST_KEYCODES(X) \
+    X(KC_NO, 0x00) \
+    X(KC_TRNS, 0x01) \
+    X(KC_A, 0x04) \
+    X(KC_B, 0x05) \
+    X(KC_C, 0x06) \
+    X(KC_D, 0x07) \
+    X(KC_E, 0x08) \
+    X(KC_F, 0x09) \
+    X(KC_G, 0x0A) \
+    X(KC_H, 0x0B) \
+    X(KC_I, 0x0C) \
+    X(KC_J, 0x0D) \
+    X(KC_K, 0x0E) \
+    X(KC_L, 0x0F) \
+    X(KC_M, 0x10) \
+    X(KC_N, 0x11) \
+    X(KC_O, 0x12) \
+    X(KC_P, 0x13) \
+    X(KC_Q, 0x14) \
+    X(KC_R, 0x15) \
+    X(KC_S, 0x16) \
+    X(KC_T, 0x17) \
+    X(KC_U, 0x18) \
+    X(KC_V, 0x19) \
+    X(KC_W, 0x1A) \
+    X(KC_X, 0x1B) \
+    X(KC_Y, 0x1C) \
+    X(KC_Z, 0x1D) \
+    X(KC_1, 0x1E) \
+    X(KC_2, 0x1F) \
+    X(KC_3, 0x20) \
+    X(KC_4, 0x21) \
+    X(KC_5, 0x22) \
+    X(KC_6, 0x23) \
+    X(KC_7, 0x24) \
+    X(KC_8, 0x25) \
+    X(KC_9, 0x26) \
+    X(KC_0, 0x27) \
+    X(KC_ENT, 0x28) \
+    X(KC_ESC, 0x29) \
+    X(KC_BSPC, 0x2A) \
+    X(KC_TAB, 0x2B) \
+    X(KC_SPC, 0x2C) \
+    X(KC_MINS, 0x2D) \
+    X(KC_EQL, 0x2E) \
+    X(KC_LBRC, 0x2F) \
+    X(KC_RBRC, 0x30) \
+    X(KC_BSLS, 0x31) \
+    X(KC_SCLN, 0x33) \
+    X(KC_QUOT, 0x34) \
+    X(KC_GRV, 0x35) \
+    X(KC_COMM, 0x36) \
+    X(KC_DOT, 0x37) \
+    X(KC_SLSH, 0x38) \
+    X(KC_CAPS, 0x39) \
+    X(KC_F1, 0x3A) \
+    X(KC_F2, 0x3B) \
+    X(KC_F3, 0x3C) \
+    X(KC_F4, 0x3D) \
+    X(KC_F5, 0x3E) \
+    X(KC_F6, 0x3F) \
+    X(KC_F7, 0x40) \
+    X(KC_F8, 0x41) \
+    X(KC_F9, 0x42) \
+    X(KC_F10, 0x43) \
+    X(KC_F11, 0x44) \
+    X(KC_F12, 0x45) \
+    X(KC_RGHT, 0x4F) \
+    X(KC_LEFT, 0x50) \
+    X(KC_DOWN, 0x51) \
+    X(KC_UP, 0x52) \
+    X(KC_LCTL, 0xE0) \
+    X(KC_LSFT, 0xE1) \
+    X(KC_LALT, 0xE2) \
+    X(KC_LGUI, 0xE3) \
+    X(KC_RCTL, 0xE4) \
+    X(KC_RSFT, 0xE5) \
+    X(KC_RALT, 0xE6) \
+    X(KC_RGUI, 0xE7) \
+    X(KC_TILD, LSFT(KC_GRV)) \
+    X(KC_EXLM, LSFT(KC_1)) \
+    X(KC_AT, LSFT(KC_2)) \
+    X(KC_HASH, LSFT(KC_3)) \
+    X(KC_DLR, LSFT(KC_4)) \
+    X(KC_PERC, LSFT(KC_5)) \
+    X(KC_CIRC, LSFT(KC_6)) \
+    X(KC_AMPR, LSFT(KC_7)) \
+    X(KC_ASTR, LSFT(KC_8)) \
+    X(KC_LPRN, LSFT(KC_9)) \
+    X(KC_RPRN, LSFT(KC_0)) \
+    X(KC_UNDS, LSFT(KC_MINS)) \
+    X(KC_PLUS, LSFT(KC_EQL)) \
+    X(KC_LCBR, LSFT(KC_LBRC)) \
+    X(KC_RCBR, LSFT(KC_RBRC)) \
+    X(KC_PIPE, LSFT(KC_BSLS))
+
+#define HOST_KEYCODE_ENUM(name, value) name = value,
+enum host_keycodes
+{
+    HOST_KEYCODES(HOST_KEYCODE_ENUM)
+};
+#undef HOST_KEYCODE_ENUM
@@ -0,0 +1,176 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+#include "pbm.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Skip whitespace and comments between header fields
+static void skip_space(FILE *file)
+{
+    int c;
+    while ((c = fgetc(file)) != EOF)
+    {
+        if (c == '#')
+        {
+            while ((c = fgetc(file)) != EOF && c != '\n')
+                ;
+        }
+        else if (!isspace(c))
+        {
+            ungetc(c, file);
+            return;
+        }
+    }
+}
+
+static int read_number(FILE *file)
+{
+    int value = 0;
+    skip_space(file);
+    if (fscanf(file, "%d", &value) != 1)
+        return -1;
+    return value;
+}
+
+int image_load(char const *path, image_t *image)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+    {
+        perror(path);
+        return -1;
+    }
+
+    char magic[3] = {0};
+    int maxval = 1;
+    if (fread(magic, 1, 2, file) != 2 || magic[0] != 'P' || !strchr("1245", magic[1]))
+    {
+        fprintf(stderr, "%s: not a P1, P2, P4 or P5 netpbm image\n", path);
+        fclose(file);
+        return -1;
+    }
+    image->width = read_number(file);
+    image->height = read_number(file);
+    if (magic[1] == '2' || magic[1] == '5')
+        maxval = read_number(file);
+    if (image->width <= 0 || image->height <= 0 || maxval <= 0 || maxval > 255)
+    {
+        fprintf(stderr, "%s: bad header\n", path);
+        fclose(file);
+        return -1;
+    }
+    // Raw formats have exactly one whitespace byte before the data
+    if (magic[1] == '4' || magic[1] == '5')
+        fgetc(file);
+
+    size_t const size = (size_t)image->width * image->height;
+    image->pixels = calloc(size, 1);
+    int ok = 1;
+    for (int y = 0; ok && y < image->height; y++)
+    {
+        int bits = 0;
+        int byte = 0;
+        for (int x = 0; ok && x < image->width; x++)
+        {
+            int value = 0;
+            switch (magic[1])
+            {
+            case '1':
+                skip_space(file);
+                value = fgetc(file);
+                ok = value == '0' || value == '1';
+                value = value == '1';
+                break;
+            case '4':
+                if (!bits)
+                {
+                    byte = fgetc(file);
+                    ok = byte != EOF;
+                    bits = 8;
+                }
+                value = (byte >> --bits) & 1;
+                break;
+            case '2':
+                value = read_number(file);
+                ok = value >= 0;
+                value = value * 2 < maxval;
+                break;
+            case '5':
+                value = fgetc(file);
+                ok = value != EOF;
+                value = value * 2 < maxval;
+                break;
+            }
+            image->pixels[(size_t)y * image->width + x] = value;
+        }
+    }
+    fclose(file);
+
+    if (!ok)
+    {
+        fprintf(stderr, "%s: truncated image data\n", path);
+        image_free(image);
+        return -1;
+    }
+    return 0;
+}
+
+void image_free(image_t *image)
+{
+    free(image->pixels);
+    image->pixels = NULL;
+}
+
+int image_frames(image_t const *image, int width, int height)
+{
+    return (image->width / width) * (image->height / height);
+}
+
+void image_frame(image_t const *image, int index, int width, int height, unsigned char *pages)
+{
+    int const columns = image->width / width;
+    int const left = index % columns * width;
+    int const top = index / columns * height;
+
+    memset(pages, 0, (size_t)width * height / 8);
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            if (image->pixels[(size_t)(top + y) * image->width + left + x])
+                pages[y / 8 * width + x] |= 1 << (y % 8);
+        }
+    }
+}
+
+int image_save_pages(char const *path, unsigned char const *pages, int width, int height)
+{
+    FILE *file = fopen(path, "wb");
+    if (!file)
+    {
+        perror(path);
+        return -1;
+    }
+
+    fprintf(file, "P4\n%d %d\n", width, height);
+    for (int y = 0; y < height; y++)
+    {
+        int byte = 0;
+        for (int x = 0; x < width; x++)
+        {
+            byte = byte << 1 | ((pages[y / 8 * width + x] >> (y % 8)) & 1);
+            if (x % 8 == 7)
+            {
+                fputc(byte, file);
+                byte = 0;
+            }
+        }
+        if (width % 8)
+            fputc(byte << (8 - width % 8), file);
+    }
+    return fclose(file);
+}
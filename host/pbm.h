@@ -0,0 +1,31 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Netpbm image helpers for the host tools. Images are held one byte
+   per pixel, non-zero for a lit OLED pixel, and converted to and from
+   the OLED page layout: byte (y / 8) * width + x, bit y % 8.
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+typedef struct
+{
+    int width;
+    int height;
+    unsigned char *pixels;
+} image_t;
+
+// Load P1, P4, P2 or P5, dark pixels are lit. Returns 0 on success.
+int image_load(char const *path, image_t *image);
+void image_free(image_t *image);
+
+// Number of width x height frames in a sprite sheet
+int image_frames(image_t const *image, int width, int height);
+
+// Copy frame index, left to right then top to bottom, into page layout
+void image_frame(image_t const *image, int index, int width, int height, unsigned char *pages);
+
+// Write page layout bytes as a raw P4 bitmap. Returns 0 on success.
+int image_save_pages(char const *path, unsigned char const *pages, int width, int height);
@@ -0,0 +1,8 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Stand-in for QMK's "progmem.h", included by "oled/oledfont.c" */
+
+#pragma once
+
+#include "qmk.h"
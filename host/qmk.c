@@ -0,0 +1,374 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Host implementation of the QMK calls declared in "qmk.h".
+   The OLED buffer and dirty flags follow the SSD1306 driver so
+   decode paths can be compared byte for byte with the firmware.
+ */
+
+#include "qmk.h"
+#include "transactions.h"
+
+#include <time.h>
+
+#define OLED_FONT_WIDTH 6
+
+uint32_t host_timer = 0;
+
+uint32_t host_clock_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+uint16_t timer_read(void)
+{
+    return (uint16_t)host_timer;
+}
+
+uint32_t timer_read32(void)
+{
+    return host_timer;
+}
+
+uint16_t timer_elapsed(uint16_t last)
+{
+    return (uint16_t)(host_timer - last);
+}
+
+uint32_t timer_elapsed32(uint32_t last)
+{
+    return host_timer - last;
+}
+
+bool host_keyboard_left = false;
+bool host_keyboard_master = true;
+
+bool is_keyboard_left(void)
+{
+    return host_keyboard_left;
+}
+
+bool is_keyboard_master(void)
+{
+    return host_keyboard_master;
+}
+
+uint8_t host_mods = 0;
+uint8_t host_oneshot_mods = 0;
+led_t host_led_state = {0};
+layer_state_t layer_state = 0;
+
+uint8_t get_mods(void)
+{
+    return host_mods;
+}
+
+uint8_t get_oneshot_mods(void)
+{
+    return host_oneshot_mods;
+}
+
+void set_mods(uint8_t mods)
+{
+    host_mods = mods;
+}
+
+void set_oneshot_mods(uint8_t mods)
+{
+    host_oneshot_mods = mods;
+}
+
+led_t host_keyboard_led_state(void)
+{
+    return host_led_state;
+}
+
+// Layer 0 is on when no bit is set, as in QMK's layer_state_cmp()
+bool layer_state_is(uint8_t layer)
+{
+    if (!layer_state)
+    {
+        return layer == 0;
+    }
+    return (layer_state & ((layer_state_t)1 << layer)) != 0;
+}
+
+layer_state_t default_layer_state = 1;
+
+bool host_keycode(char const *name, uint16_t *keycode)
+{
+#define HOST_KEYCODE_NAME(name, value) {#name, value},
+    static struct
+    {
+        char const *name;
+        uint16_t keycode;
+    } const names[] = {HOST_KEYCODES(HOST_KEYCODE_NAME)};
+#undef HOST_KEYCODE_NAME
+    unsigned layer;
+
+    if (sscanf(name, "MO(%u)", &layer) == 1)
+    {
+        *keycode = MO(layer);
+        return layer < 32;
+    }
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); ++i)
+    {
+        if (!strcmp(names[i].name, name))
+        {
+            *keycode = names[i].keycode;
+            return true;
+        }
+    }
+    return false;
+}
+
+__attribute__((weak)) uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key)
+{
+    return KC_NO;
+}
+
+// As QMK's get_event_keycode() with its source layers cache
+uint16_t host_key_to_keycode(keypos_t key, bool pressed)
+{
+    static uint8_t source_layers[MATRIX_ROWS][MATRIX_COLS];
+    uint8_t layer = 0;
+
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS)
+    {
+        return KC_NO;
+    }
+    if (pressed)
+    {
+        // layer_switch_get_layer()
+        layer_state_t const layers = layer_state | default_layer_state;
+        for (int8_t i = sizeof(layer_state_t) * 8 - 1; i >= 0; --i)
+        {
+            if (layers & (layer_state_t)1 << i && keymap_key_to_keycode(i, key) != KC_TRNS)
+            {
+                layer = i;
+                break;
+            }
+        }
+        source_layers[key.row][key.col] = layer;
+    }
+    else
+    {
+        layer = source_layers[key.row][key.col];
+    }
+    return keymap_key_to_keycode(layer, key);
+}
+
+#ifdef WPM_ENABLE
+uint8_t host_wpm = 0;
+
+uint8_t get_current_wpm(void)
+{
+    return host_wpm;
+}
+#endif
+
+uint32_t host_split_bytes = 0;
+bool host_split_connected = true;
+
+static slave_callback_t split_handlers[NUM_TOTAL_TRANSACTIONS];
+
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback)
+{
+    if (transaction_id >= 0 && transaction_id < NUM_TOTAL_TRANSACTIONS)
+    {
+        split_handlers[transaction_id] = callback;
+    }
+}
+
+bool transaction_rpc_send(int8_t transaction_id, size_t initiator2target_buflen, const void *initiator2target_buf)
+{
+    if (!host_split_connected || transaction_id < 0 || transaction_id >= NUM_TOTAL_TRANSACTIONS ||
+        !split_handlers[transaction_id])
+    {
+        return false;
+    }
+    host_split_bytes += initiator2target_buflen;
+    split_handlers[transaction_id](initiator2target_buflen, initiator2target_buf, 0, NULL);
+    return true;
+}
+
+uint8_t oled_buffer[OLED_MATRIX_SIZE];
+OLED_BLOCK_TYPE oled_dirty = 0;
+bool oled_active = true;
+oled_rotation_t host_oled_rotation = OLED_ROTATION_0;
+uint8_t host_oled_panel[OLED_MATRIX_SIZE];
+uint32_t host_oled_raw_writes = 0;
+uint32_t host_oled_rotated_tiles = 0;
+uint32_t host_pgm_reads = 0;
+
+static uint16_t oled_cursor = 0;
+
+void oled_clear(void)
+{
+    memset(oled_buffer, 0, sizeof(oled_buffer));
+    oled_cursor = 0;
+    oled_dirty = (OLED_BLOCK_TYPE)~0;
+}
+
+void oled_set_cursor(uint8_t col, uint8_t line)
+{
+    uint8_t const width = host_oled_rotation & OLED_ROTATION_90 ? OLED_DISPLAY_HEIGHT : OLED_DISPLAY_WIDTH;
+    uint16_t index = line * width + col * OLED_FONT_WIDTH;
+    oled_cursor = index < OLED_MATRIX_SIZE ? index : 0;
+}
+
+void oled_write_raw_byte(const char data, uint16_t index)
+{
+    ++host_oled_raw_writes;
+    if (index > OLED_MATRIX_SIZE - 1)
+    {
+        index = OLED_MATRIX_SIZE - 1;
+    }
+    if (oled_buffer[index] == (uint8_t)data)
+    {
+        return;
+    }
+    oled_buffer[index] = data;
+    oled_dirty |= ((OLED_BLOCK_TYPE)1 << (index / OLED_BLOCK_SIZE));
+}
+
+void oled_write_raw_P(const char *data, uint16_t size)
+{
+    if (size + oled_cursor > OLED_MATRIX_SIZE)
+    {
+        size = OLED_MATRIX_SIZE - oled_cursor;
+    }
+    for (uint16_t i = oled_cursor; i < oled_cursor + size; i++)
+    {
+        uint8_t c = pgm_read_byte(data++);
+        if (oled_buffer[i] == c)
+        {
+            continue;
+        }
+        oled_buffer[i] = c;
+        oled_dirty |= ((OLED_BLOCK_TYPE)1 << (i / OLED_BLOCK_SIZE));
+    }
+}
+
+oled_buffer_reader_t oled_read_raw(uint16_t start_index)
+{
+    if (start_index > OLED_MATRIX_SIZE)
+    {
+        start_index = OLED_MATRIX_SIZE;
+    }
+    oled_buffer_reader_t reader = {oled_buffer + start_index, OLED_MATRIX_SIZE - start_index};
+    return reader;
+}
+
+bool oled_on(void)
+{
+    oled_active = true;
+    return oled_active;
+}
+
+bool oled_off(void)
+{
+    oled_active = false;
+    return !oled_active;
+}
+
+bool is_oled_on(void)
+{
+    return oled_active;
+}
+
+#ifdef OLED_FONT_H
+// Defaults come before the font as in the driver, fonts can check them
+#ifndef OLED_FONT_START
+#define OLED_FONT_START 0
+#endif
+#ifndef OLED_FONT_END
+#define OLED_FONT_END 223
+#endif
+
+#include OLED_FONT_H
+
+// Characters advance by OLED_FONT_WIDTH and wrap to the next line when
+// the rest of the line is narrower than a glyph
+void oled_write_char(const char data, bool invert)
+{
+    uint8_t const width = host_oled_rotation & OLED_ROTATION_90 ? OLED_DISPLAY_HEIGHT : OLED_DISPLAY_WIDTH;
+    uint8_t glyph[OLED_FONT_WIDTH] = {0};
+    uint8_t const c = data;
+
+    if (c >= OLED_FONT_START && c <= OLED_FONT_END)
+    {
+        memcpy_P(glyph, &font[(c - OLED_FONT_START) * OLED_FONT_WIDTH], OLED_FONT_WIDTH);
+    }
+    for (uint8_t i = 0; i < OLED_FONT_WIDTH; ++i)
+    {
+        uint8_t const byte = invert ? ~glyph[i] : glyph[i];
+        if (oled_buffer[oled_cursor + i] != byte)
+        {
+            oled_buffer[oled_cursor + i] = byte;
+            oled_dirty |= ((OLED_BLOCK_TYPE)1 << ((oled_cursor + i) / OLED_BLOCK_SIZE));
+        }
+    }
+
+    uint16_t next = oled_cursor + OLED_FONT_WIDTH;
+    uint8_t const remaining = width - next % width;
+    if (remaining < OLED_FONT_WIDTH)
+    {
+        next += remaining;
+    }
+    oled_cursor = next < OLED_MATRIX_SIZE ? next : 0;
+}
+
+void oled_write_P(const char *data, bool invert)
+{
+    for (uint8_t c = pgm_read_byte(data); c; c = pgm_read_byte(++data))
+    {
+        oled_write_char(c, invert);
+    }
+}
+#endif
+
+// Transpose an 8x8 tile of 90 degree buffer columns into panel columns
+static void rotate_90(uint8_t const *src, uint8_t *dest)
+{
+    for (uint8_t i = 0; i < 8; ++i)
+    {
+        uint8_t column = 0;
+        for (uint8_t j = 0; j < 8; ++j)
+        {
+            column |= ((src[j] >> i) & 1) << (7 - j);
+        }
+        dest[i] = column;
+    }
+}
+
+// Rotations of 0 and 180 are sent as is and flipped by the panel. For
+// 90 and 270 each dirty block is one 32 byte page of the rotated buffer
+// and becomes 8 panel columns of every page, transposed tile by tile.
+void host_oled_render(void)
+{
+    for (uint8_t block = 0; block < OLED_BLOCK_COUNT; ++block)
+    {
+        if (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << block)))
+        {
+            continue;
+        }
+        uint8_t const *src = oled_buffer + block * OLED_BLOCK_SIZE;
+        if (host_oled_rotation & OLED_ROTATION_90)
+        {
+            for (uint8_t tile = 0; tile < OLED_DISPLAY_HEIGHT / 8; ++tile)
+            {
+                uint8_t page = OLED_DISPLAY_HEIGHT / 8 - 1 - tile;
+                rotate_90(src + tile * 8, host_oled_panel + page * OLED_DISPLAY_WIDTH + block * 8);
+                ++host_oled_rotated_tiles;
+            }
+        }
+        else
+        {
+            memcpy(host_oled_panel + block * OLED_BLOCK_SIZE, src, OLED_BLOCK_SIZE);
+        }
+    }
+    oled_dirty = 0;
+}
@@ -0,0 +1,203 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Minimal stand-in for QMK_KEYBOARD_H so userspace modules can be
+   compiled and exercised on Linux. Only the API used under "oled/"
+   is provided, with the same semantics as the QMK SSD1306 driver.
+
+   Compile userspace sources against it with:
+        -Ihost -DQMK_KEYBOARD_H='"qmk.h"'
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Program memory is ordinary memory on the host, reads are counted
+// as a proxy for decode cycles on AVR where each costs an LPM
+extern uint32_t host_pgm_reads;
+
+#define PROGMEM
+#define PSTR(s) (s)
+#define pgm_read_byte(address) (++host_pgm_reads, *(uint8_t const *)(address))
+#define pgm_read_word(address) (host_pgm_reads += 2, *(uint16_t const *)(address))
+#define memcpy_P(dest, src, n) (host_pgm_reads += (n), memcpy((dest), (src), (n)))
+
+// Timers read the simulated clock in host_timer
+extern uint32_t host_timer;
+
+// Wall clock microseconds, for OLED_PROFILE_US() in host builds
+uint32_t host_clock_us(void);
+
+uint16_t timer_read(void);
+uint32_t timer_read32(void);
+uint16_t timer_elapsed(uint16_t last);
+uint32_t timer_elapsed32(uint32_t last);
+
+// Both split halves share host_timer, so the synced timer is the same
+#define sync_timer_read() timer_read()
+#define sync_timer_read32() timer_read32()
+#define sync_timer_elapsed32(last) timer_elapsed32(last)
+
+// Console output goes to stdout
+#define uprintf printf
+
+// Split keyboard role
+extern bool host_keyboard_left;
+extern bool host_keyboard_master;
+
+bool is_keyboard_left(void);
+bool is_keyboard_master(void);
+
+// Modifiers, LED and layer state set by the host program
+#define MOD_BIT(code) (1 << ((code) & 0x07))
+#define MOD_MASK_CTRL 0x11
+#define MOD_MASK_SHIFT 0x22
+#define MOD_MASK_ALT 0x44
+#define MOD_MASK_GUI 0x88
+#define MOD_MASK_CAG (MOD_MASK_CTRL | MOD_MASK_ALT | MOD_MASK_GUI)
+
+typedef uint32_t layer_state_t;
+
+typedef union
+{
+    uint8_t raw;
+    struct
+    {
+        bool num_lock : 1;
+        bool caps_lock : 1;
+        bool scroll_lock : 1;
+        bool compose : 1;
+        bool kana : 1;
+        uint8_t reserved : 3;
+    };
+} led_t;
+
+extern uint8_t host_mods;
+extern uint8_t host_oneshot_mods;
+extern led_t host_led_state;
+extern layer_state_t layer_state;
+extern layer_state_t default_layer_state;
+
+uint8_t get_mods(void);
+uint8_t get_oneshot_mods(void);
+void set_mods(uint8_t mods);
+void set_oneshot_mods(uint8_t mods);
+led_t host_keyboard_led_state(void);
+bool layer_state_is(uint8_t layer);
+
+// Key events passed to 'process_record_user()'
+typedef struct
+{
+    uint8_t col;
+    uint8_t row;
+} keypos_t;
+
+typedef struct
+{
+    keypos_t key;
+    bool pressed;
+    uint16_t time;
+} keyevent_t;
+
+typedef struct
+{
+    keyevent_t event;
+} keyrecord_t;
+
+// lily58/rev1 matrix and the keycodes of its keymap
+#define MATRIX_ROWS 10
+#define MATRIX_COLS 6
+
+#include "keycodes.h"
+
+// Keycode name to value, false for names missing from "keycodes.h"
+bool host_keycode(char const *name, uint16_t *keycode);
+
+// Keycode of a key event the way QMK's action code reads the keymap. A
+// press walks down the active layers past KC_TRNS and caches the layer
+// it stops at, the release reads that layer again. Keymap lookups go
+// through the keymap's 'keymap_key_to_keycode()', which defaults to
+// KC_NO on every layer when no keymap is linked.
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
+uint16_t host_key_to_keycode(keypos_t key, bool pressed);
+
+#ifdef WPM_ENABLE
+extern uint8_t host_wpm;
+
+uint8_t get_current_wpm(void);
+#endif
+
+// 128x32 SSD1306 OLED
+#ifndef OLED_DISPLAY_WIDTH
+#define OLED_DISPLAY_WIDTH 128
+#endif
+#ifndef OLED_DISPLAY_HEIGHT
+#define OLED_DISPLAY_HEIGHT 32
+#endif
+#define OLED_MATRIX_SIZE (OLED_DISPLAY_HEIGHT / 8 * OLED_DISPLAY_WIDTH)
+#define OLED_BLOCK_TYPE uint16_t
+#define OLED_BLOCK_COUNT (sizeof(OLED_BLOCK_TYPE) * 8)
+#define OLED_BLOCK_SIZE (OLED_MATRIX_SIZE / OLED_BLOCK_COUNT)
+#ifndef OLED_TIMEOUT
+#define OLED_TIMEOUT 60000
+#endif
+
+typedef enum
+{
+    OLED_ROTATION_0 = 0,
+    OLED_ROTATION_90 = 1,
+    OLED_ROTATION_180 = 2,
+    OLED_ROTATION_270 = 3,
+} oled_rotation_t;
+
+typedef struct
+{
+    uint8_t *current_element;
+    uint16_t remaining_element_count;
+} oled_buffer_reader_t;
+
+extern uint8_t oled_buffer[OLED_MATRIX_SIZE];
+extern OLED_BLOCK_TYPE oled_dirty;
+extern bool oled_active;
+
+// Rotation returned by oled_init_user(), set by the host program
+extern oled_rotation_t host_oled_rotation;
+
+// Panel memory as last flushed by host_oled_render(), before the
+// hardware flip of OLED_ROTATION_180 and 270
+extern uint8_t host_oled_panel[OLED_MATRIX_SIZE];
+
+// Driver call counters for benchmarks
+extern uint32_t host_oled_raw_writes;
+extern uint32_t host_oled_rotated_tiles;
+
+void oled_clear(void);
+void oled_set_cursor(uint8_t col, uint8_t line);
+void oled_write_raw_byte(const char data, uint16_t index);
+void oled_write_raw_P(const char *data, uint16_t size);
+oled_buffer_reader_t oled_read_raw(uint16_t start_index);
+bool oled_on(void);
+bool oled_off(void);
+bool is_oled_on(void);
+#ifdef OLED_FONT_H
+// Glyphs come from OLED_FONT_H as in the driver
+void oled_write_char(const char data, bool invert);
+void oled_write_P(const char *data, bool invert);
+#endif
+
+// Userspace callbacks
+oled_rotation_t oled_init_user(oled_rotation_t rotation);
+bool oled_task_user(void);
+bool process_record_user(uint16_t keycode, keyrecord_t *record);
+layer_state_t layer_state_set_user(layer_state_t state);
+bool led_update_user(led_t led_state);
+void keyboard_post_init_user(void);
+void housekeeping_task_user(void);
+
+// Flush dirty blocks to host_oled_panel like the driver's oled_render()
+void host_oled_render(void);
@@ -0,0 +1,358 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Keystroke replay simulator for the userspace on Linux. The keymap
+   hooks in "ethanharstad.c" and the OLED modules run against the QMK
+   mock in "qmk.h", one matrix scan per simulated millisecond and as
+   fast as the host allows. Key events of a timeline are fed to
+   'process_record_user()' along with the modifier, layer and LED
+   changes they cause. The primary half's work, including the split
+   status sent by "oled-sync.c", runs every scan, and the OLED pass
+   runs as the chosen half, after applying that status as a secondary. Every pass that flushes the OLED is written
+   as a PBM in display orientation, and every render is a row of a CSV
+   with its timings.
+
+   A timeline line is a time in milliseconds and an event:
+        <ms> press KC_LSFT      Key down, modifiers and MO(n) are tracked
+        <ms> release KC_LSFT    Key up
+        <ms> tap KC_A           Key down and up in the same scan
+        <ms> key                Same as 'tap', for "host/traces/" files
+   KC_CAPS toggles caps lock on press. Other words, such as the bucket
+   expectations of "host/traces/", and '#' comments are ignored. Keys
+   are pressed at their first matrix position in the keymap, lowest
+   layer first, and looked up as QMK would with the layer state of the
+   moment. Lookup costs are summed over the replay.
+
+   Build from the userspace root with one pet module, the same sources
+   as rules.mk and config.h as the QMK build would:
+        cc -O2 -Ihost -DQMK_KEYBOARD_H='"qmk.h"' -include config.h \
+            -DOLED_ENABLE -DOLED_FONT_H='"../oled/oledfont.c"' \
+            -DKEYMAP_JSON_CKSUM=$(cksum < ethanharstad.json | cut -d' ' -f1) \
+            -o sim host/sim.c host/qmk.c host/pbm.c ethanharstad.c \
+            keymap/keymap-sparse.c \
+            oled/oled-bongocat.c oled/oled-sprite.c oled/oled-codec.c \
+            oled/oled-icons.c oled/oled-typing.c oled/oled-sync.c
+        ./sim [-s] [-l] [-t tail] [-o dir] timeline
+   -s runs the OLED as the secondary half and -l as the left half. The
+   replay continues tail milliseconds, 5000 by default, after the last
+   event. Frames and "renders.csv" go into dir, "sim-out" by default.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "pbm.h"
+#include "qmk.h"
+
+typedef enum
+{
+    EVENT_PRESS,
+    EVENT_RELEASE,
+    EVENT_TAP,
+} event_type_t;
+
+typedef struct
+{
+    uint32_t time;
+    event_type_t type;
+    char key[16];
+    keypos_t position;
+    bool mapped; // False for keys missing from the keymap
+} event_t;
+
+typedef struct
+{
+    event_t *events;
+    size_t count;
+} timeline_t;
+
+// Modifier keys in MOD_BIT() order
+static char const *const mod_keys[] = {"KC_LCTL", "KC_LSFT", "KC_LALT", "KC_LGUI",
+                                       "KC_RCTL", "KC_RSFT", "KC_RALT", "KC_RGUI"};
+
+static double now_us(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+// First matrix position of a keycode, lowest layer first
+static bool find_key(char const *key, keypos_t *position)
+{
+    uint16_t keycode;
+    if (!host_keycode(key, &keycode) || keycode == KC_NO || keycode == KC_TRNS)
+    {
+        return false;
+    }
+    for (uint8_t layer = 0; layer < sizeof(layer_state_t) * 8; ++layer)
+    {
+        for (position->row = 0; position->row < MATRIX_ROWS; ++position->row)
+        {
+            for (position->col = 0; position->col < MATRIX_COLS; ++position->col)
+            {
+                if (keymap_key_to_keycode(layer, *position) == keycode)
+                {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+static int load_timeline(char const *path, timeline_t *timeline)
+{
+    FILE *file = fopen(path, "r");
+    if (!file)
+    {
+        perror(path);
+        return 1;
+    }
+
+    char line[128];
+    size_t capacity = 0;
+    unsigned number = 0;
+    timeline->events = NULL;
+    timeline->count = 0;
+    while (fgets(line, sizeof(line), file))
+    {
+        unsigned long time;
+        char word[16];
+        event_t event = {0};
+        int const fields = sscanf(line, "%lu %15s %15s", &time, word, event.key);
+
+        ++number;
+        if (line[0] == '#' || fields < 2)
+        {
+            continue;
+        }
+        if (timeline->count && time < timeline->events[timeline->count - 1].time)
+        {
+            fprintf(stderr, "%s:%u: events out of order\n", path, number);
+            fclose(file);
+            return 1;
+        }
+        event.time = time;
+        if (!strcmp(word, "key"))
+        {
+            event.type = EVENT_TAP;
+            strcpy(event.key, "KC_A");
+        }
+        else if (fields == 3 && !strcmp(word, "press"))
+        {
+            event.type = EVENT_PRESS;
+        }
+        else if (fields == 3 && !strcmp(word, "release"))
+        {
+            event.type = EVENT_RELEASE;
+        }
+        else if (fields == 3 && !strcmp(word, "tap"))
+        {
+            event.type = EVENT_TAP;
+        }
+        else
+        {
+            continue;
+        }
+
+        event.mapped = find_key(event.key, &event.position);
+
+        if (timeline->count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 256;
+            timeline->events = realloc(timeline->events, capacity * sizeof(event_t));
+        }
+        timeline->events[timeline->count++] = event;
+    }
+    fclose(file);
+    return 0;
+}
+
+// Keymap lookups made by apply_key()
+static uint32_t lookups = 0;
+static uint32_t lookup_reads = 0;
+static double lookup_total = 0;
+
+// Apply what the keymap would do with the key, then run the record hook
+static void apply_key(event_t const *event, bool const pressed)
+{
+    char const *key = event->key;
+    keyrecord_t record = {.event = {.key = event->position, .pressed = pressed, .time = timer_read()}};
+    uint16_t keycode = KC_NO;
+    unsigned layer;
+
+    if (event->mapped)
+    {
+        uint32_t const reads = host_pgm_reads;
+        double const start = now_us();
+        keycode = host_key_to_keycode(event->position, pressed);
+        lookup_total += now_us() - start;
+        lookup_reads += host_pgm_reads - reads;
+        ++lookups;
+    }
+
+    for (uint8_t i = 0; i < sizeof(mod_keys) / sizeof(mod_keys[0]); ++i)
+    {
+        if (!strcmp(key, mod_keys[i]))
+        {
+            host_mods = pressed ? host_mods | 1 << i : host_mods & ~(1 << i);
+        }
+    }
+    if (sscanf(key, "MO(%u)", &layer) == 1 && layer < 32)
+    {
+        layer_state_t const bit = (layer_state_t)1 << layer;
+        layer_state = layer_state_set_user(pressed ? layer_state | bit : layer_state & ~bit);
+    }
+    if (pressed && !strcmp(key, "KC_CAPS"))
+    {
+        host_led_state.caps_lock = !host_led_state.caps_lock;
+        led_update_user(host_led_state);
+    }
+
+    process_record_user(keycode, &record);
+}
+
+// Count set bits of the dirty block mask
+static uint8_t count_blocks(OLED_BLOCK_TYPE dirty)
+{
+    uint8_t count = 0;
+    for (; dirty; dirty &= dirty - 1)
+    {
+        ++count;
+    }
+    return count;
+}
+
+int main(int argc, char *const argv[])
+{
+    extern uint32_t oled_renders;
+    char const *dir = "sim-out";
+    uint32_t tail = 5000;
+    bool primary = true;
+    int arg = 1;
+
+    for (; arg < argc && argv[arg][0] == '-'; ++arg)
+    {
+        if (!strcmp(argv[arg], "-s"))
+        {
+            primary = false;
+        }
+        else if (!strcmp(argv[arg], "-l"))
+        {
+            host_keyboard_left = true;
+        }
+        else if (!strcmp(argv[arg], "-t") && arg + 1 < argc)
+        {
+            tail = strtoul(argv[++arg], NULL, 10);
+        }
+        else if (!strcmp(argv[arg], "-o") && arg + 1 < argc)
+        {
+            dir = argv[++arg];
+        }
+        else
+        {
+            break;
+        }
+    }
+    if (arg != argc - 1)
+    {
+        fprintf(stderr, "Usage: %s [-s] [-l] [-t tail] [-o dir] timeline\n", argv[0]);
+        return 2;
+    }
+
+    timeline_t timeline;
+    if (load_timeline(argv[arg], &timeline))
+    {
+        return 1;
+    }
+    mkdir(dir, 0777);
+    char path[512];
+    snprintf(path, sizeof(path), "%s/renders.csv", dir);
+    FILE *csv = fopen(path, "w");
+    if (!csv)
+    {
+        perror(path);
+        return 1;
+    }
+    fprintf(csv, "render,ms,oled_on,render_us,flush_us,pgm_reads,dirty_blocks,rotated_tiles,frame\n");
+
+    host_keyboard_master = primary;
+    keyboard_post_init_user();
+    host_oled_rotation = oled_init_user(OLED_ROTATION_0);
+    bool const tall = host_oled_rotation & OLED_ROTATION_90;
+
+    uint32_t const end = (timeline.count ? timeline.events[timeline.count - 1].time : 0) + tail;
+    uint32_t frames = 0;
+    double render_total = 0;
+    double render_max = 0;
+    size_t next = 0;
+    for (uint32_t ms = 0; ms <= end; ++ms)
+    {
+        host_timer = ms;
+
+        // The primary half scans keys and syncs the secondary
+        host_keyboard_master = true;
+        for (; next < timeline.count && timeline.events[next].time == ms; ++next)
+        {
+            event_t const *event = &timeline.events[next];
+            apply_key(event, event->type != EVENT_RELEASE);
+            if (event->type == EVENT_TAP)
+            {
+                apply_key(event, false);
+            }
+        }
+        housekeeping_task_user();
+        host_keyboard_master = primary;
+        if (!primary)
+        {
+            housekeeping_task_user();
+        }
+
+        uint32_t const renders = oled_renders;
+        uint32_t const reads = host_pgm_reads;
+        uint32_t const tiles = host_oled_rotated_tiles;
+        double const start = now_us();
+        // The driver's oled_task() homes the cursor before every pass
+        oled_set_cursor(0, 0);
+        oled_task_user();
+        double const rendered = now_us();
+        OLED_BLOCK_TYPE const dirty = oled_dirty;
+        host_oled_render();
+        double const flushed = now_us();
+
+        if (renders == oled_renders)
+        {
+            continue;
+        }
+        path[0] = 0;
+        if (dirty)
+        {
+            snprintf(path, sizeof(path), "%s/frame-%05u.pbm", dir, frames++);
+            image_save_pages(path, oled_buffer, tall ? OLED_DISPLAY_HEIGHT : OLED_DISPLAY_WIDTH,
+                             tall ? OLED_DISPLAY_WIDTH : OLED_DISPLAY_HEIGHT);
+        }
+        render_total += rendered - start;
+        render_max = rendered - start > render_max ? rendered - start : render_max;
+        fprintf(csv, "%u,%u,%d,%.3f,%.3f,%u,%u,%u,%s\n", oled_renders, ms, oled_active, rendered - start,
+                flushed - rendered, host_pgm_reads - reads, count_blocks(dirty), host_oled_rotated_tiles - tiles,
+                dirty ? strrchr(path, '/') + 1 : "");
+    }
+    fclose(csv);
+    free(timeline.events);
+
+    printf("%u scans, %u renders, %u frames written to %s\n", end + 1, oled_renders, frames, dir);
+    if (oled_renders)
+    {
+        printf("render avg %.3f us, max %.3f us\n", render_total / oled_renders, render_max);
+    }
+    if (lookups)
+    {
+        printf("%u key lookups, avg %.1f pgm reads, %.3f us\n", lookups, (double)lookup_reads / lookups,
+               lookup_total / lookups);
+    }
+    return 0;
+}
@@ -0,0 +1,32 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Stand-in for QMK's split "transactions.h". Both halves run in one
+   process, so a sent transaction calls the registered handler directly.
+   User transaction IDs come from SPLIT_TRANSACTION_IDS_USER as in
+   config.h, passed on the command line:
+        -DSPLIT_TRANSACTION_IDS_USER=OLED_SYNC_STATUS
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+enum
+{
+#ifdef SPLIT_TRANSACTION_IDS_USER
+    SPLIT_TRANSACTION_IDS_USER,
+#endif
+    NUM_TOTAL_TRANSACTIONS
+};
+
+typedef void (*slave_callback_t)(uint8_t in_buflen, const void *in_data, uint8_t out_buflen, void *out_data);
+
+// Bytes sent through transaction_rpc_send(), and whether it succeeds
+extern uint32_t host_split_bytes;
+extern bool host_split_connected;
+
+void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
+bool transaction_rpc_send(int8_t transaction_id, size_t initiator2target_buflen, const void *initiator2target_buf);
@@ -0,0 +1,107 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Host test for the typing speed estimator in "oled/oled-typing.c".
+   Key timing traces in "host/traces/" are replayed through it and the
+   activity bucket is checked wherever the trace expects one. A trace
+   line is a time in milliseconds followed by either 'key' for a key
+   press or the expected 'typing', 'slowing' or 'idle' bucket at that
+   time. Lines starting with '#' are comments.
+
+   Build and run from the userspace root:
+        cc -O2 -DTYPING_WPM -o typing host/typing.c oled/oled-typing.c
+        ./typing host/traces/burst-stop.trace host/traces/hunt-peck.trace \
+            host/traces/pauses.trace
+   Exits non-zero if any expected bucket differs.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "../oled/oled-typing.h"
+
+#ifndef TYPING_WPM
+#error "Build with -DTYPING_WPM for the rate printed with failed checks"
+#endif
+
+static char const *const bucket_names[] = {"idle", "slowing", "typing"};
+
+// Replay one trace, returns the number of failed expectations
+static int replay(char const *path)
+{
+    FILE *file = fopen(path, "r");
+    if (!file)
+    {
+        perror(path);
+        return 1;
+    }
+
+    char line[128];
+    int failures = 0;
+    int checks = 0;
+    unsigned keys = 0;
+    unsigned number = 0;
+    unsigned long last = 0;
+
+    typing_reset();
+    while (fgets(line, sizeof(line), file))
+    {
+        unsigned long time;
+        char event[16];
+        ++number;
+        if (line[0] == '#' || line[0] == '\n')
+        {
+            continue;
+        }
+        if (sscanf(line, "%lu %15s", &time, event) != 2 || time < last)
+        {
+            printf("  %s:%u: malformed or out of order\n", path, number);
+            ++failures;
+            continue;
+        }
+        last = time;
+
+        if (!strcmp(event, "key"))
+        {
+            typing_record(time);
+            ++keys;
+            continue;
+        }
+
+        typing_bucket_t const bucket = typing_bucket(time);
+        ++checks;
+        if (strcmp(event, bucket_names[bucket]))
+        {
+            printf("  %s:%u: at %lu ms expected %s, estimated %s at %u wpm\n", path, number, time, event,
+                   bucket_names[bucket], typing_wpm(time));
+            ++failures;
+        }
+    }
+    fclose(file);
+
+    printf("%-32s %4u keys %3d checks %3d failed\n", path, keys, checks, failures);
+    return failures;
+}
+
+int main(int argc, char const *argv[])
+{
+    int failures = 0;
+
+    if (argc < 2)
+    {
+        fprintf(stderr, "Usage: %s trace...\n", argv[0]);
+        return 2;
+    }
+    for (int i = 1; i < argc; ++i)
+    {
+        failures += replay(argv[i]);
+    }
+
+    if (failures)
+    {
+        printf("FAILED: %d expectations\n", failures);
+        return 1;
+    }
+    printf("All traces match\n");
+    return 0;
+}
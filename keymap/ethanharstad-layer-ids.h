@@ -0,0 +1,24 @@
+// Generated by "sparse.c", do not edit. Regenerate with:
+// ./sparse -n CMK,SYM,NUM,FNC -c keymap/ethanharstad-layer-ids.h -o keymap/ethanharstad-layers.h ethanharstad.json
+
+#pragma once
+
+// 'cksum' of ethanharstad.json, KEYMAP_JSON_CKSUM is defined by rules.mk
+#if defined(KEYMAP_JSON_CKSUM) && KEYMAP_JSON_CKSUM != 1517174541
+#error "Generated from another ethanharstad.json, regenerate with the command above"
+#endif
+
+#define CMK 0
+#define SYM 1
+#define NUM 2
+#define FNC 3
+#define LAYER_COUNT 4
+
+#define CMK_MASK (1UL << CMK)
+#define SYM_MASK (1UL << SYM)
+#define NUM_MASK (1UL << NUM)
+#define FNC_MASK (1UL << FNC)
+
+// Highest layer of every layer state
+#define LAYER_STATE_MASK ((1UL << LAYER_COUNT) - 1)
+#define LAYER_HIGHEST_TABLE {0, 0, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3}
@@ -0,0 +1,46 @@
+// Generated by "sparse.c", do not edit. Regenerate with:
+// ./sparse -n CMK,SYM,NUM,FNC -c keymap/ethanharstad-layer-ids.h -o keymap/ethanharstad-layers.h ethanharstad.json
+
+#pragma once
+
+// 'cksum' of ethanharstad.json, KEYMAP_JSON_CKSUM is defined by rules.mk
+#if defined(KEYMAP_JSON_CKSUM) && KEYMAP_JSON_CKSUM != 1517174541
+#error "Generated from another ethanharstad.json, regenerate with the command above"
+#endif
+
+#define SPARSE_LAYERS 4
+#define SPARSE_ROWS 10
+#define SPARSE_COLS 6
+
+static uint16_t const sparse_keycodes[] PROGMEM = {
+    // Layer 0, 58 keys over KC_NO
+    KC_ESC, KC_1, KC_2, KC_3, KC_4, KC_5, KC_TAB, KC_Q,
+    KC_W, KC_F, KC_P, KC_B, KC_LCTL, KC_A, KC_R, KC_S,
+    KC_T, KC_G, KC_LSFT, KC_Z, KC_X, KC_C, KC_D, KC_V,
+    KC_LALT, KC_LGUI, MO(1), KC_SPC, KC_LBRC, KC_GRV, KC_0, KC_9,
+    KC_8, KC_7, KC_6, KC_MINS, KC_SCLN, KC_Y, KC_U, KC_L,
+    KC_J, KC_QUOT, KC_O, KC_I, KC_E, KC_N, KC_M, KC_RSFT,
+    KC_SLSH, KC_DOT, KC_COMM, KC_H, KC_K, KC_RGUI, KC_BSPC, MO(2),
+    KC_ENT, KC_RBRC,
+    // Layer 1, 33 keys over KC_TRNS
+    KC_F1, KC_F2, KC_F3, KC_F4, KC_F5, KC_F6, KC_GRV, KC_EXLM,
+    KC_AT, KC_HASH, KC_DLR, KC_PERC, KC_NO, KC_F12, KC_F11, KC_F10,
+    KC_F9, KC_F8, KC_F7, KC_TILD, KC_RPRN, KC_LPRN, KC_ASTR, KC_AMPR,
+    KC_CIRC, KC_PIPE, KC_RCBR, KC_LCBR, KC_PLUS, KC_UNDS, KC_NO, KC_NO,
+    MO(3),
+    // Layer 2, 38 keys over KC_TRNS
+    KC_GRV, KC_1, KC_2, KC_3, KC_4, KC_5, KC_F1, KC_F2,
+    KC_F3, KC_F4, KC_F5, KC_F6, KC_F7, KC_F8, KC_F9, KC_F10,
+    KC_F11, KC_F12, KC_NO, MO(3), KC_0, KC_9, KC_8, KC_7,
+    KC_6, KC_NO, KC_RGHT, KC_UP, KC_DOWN, KC_LEFT, KC_NO, KC_BSLS,
+    KC_RBRC, KC_LBRC, KC_EQL, KC_MINS, KC_PLUS, KC_NO,
+    // Layer 3, 8 keys over KC_NO
+    KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS, KC_TRNS
+};
+
+static sparse_layer_t const sparse_layers[SPARSE_LAYERS] PROGMEM = {
+    {KC_NO, 0, {0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xbf, 0x0f}, {0, 8, 16, 24, 31, 39, 47, 54}},
+    {KC_TRNS, 58, {0xc0, 0xff, 0x03, 0x01, 0xf0, 0xff, 0x7f, 0x02}, {0, 2, 10, 12, 13, 17, 25, 32}},
+    {KC_TRNS, 91, {0xc0, 0xff, 0xff, 0x09, 0xe0, 0xff, 0x7f, 0x00}, {0, 2, 10, 18, 20, 23, 31, 38}},
+    {KC_NO, 129, {0x00, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x80, 0x07}, {0, 0, 0, 0, 4, 4, 4, 5}},
+};
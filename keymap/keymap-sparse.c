@@ -0,0 +1,143 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Sparse keymap layers. QMK compiles every layer as a dense keycode
+   array, even a layer of KC_TRNS with a handful of keys. Layers
+   generated by "sparse.c" only store the keycodes that differ from
+   the most common one of their layer, and this file replaces QMK's
+   keymap lookup with one into them. The dense 'keymaps' array is then
+   unreferenced and dropped by the linker.
+
+   Usage guide
+   1 Place this file, "keymap-sparse.h" and "sparse.c" in userspace.
+   2 Generate the layers and the layer names from the keymap export
+     after every change, review "sparse.c" for build instructions:
+        ./sparse -n CMK,SYM,NUM,FNC -c keymap/ethanharstad-layer-ids.h \
+            -o keymap/ethanharstad-layers.h ethanharstad.json
+     and include the layer names from config.h:
+        #include "keymap/ethanharstad-layer-ids.h"
+   3 Add the following line into rules.mk:
+        SRC += keymap/keymap-sparse.c
+   4 Layers are read from "ethanharstad-layers.h" by default, a keymap
+     can name its own header in config.h:
+        #define SPARSE_LAYERS_H "keymap/other-layers.h"
+   5 Every keypress walks the active layers from the top, one lookup per
+     layer until one isn't KC_TRNS. Positions are resolved once per layer
+     state into RAM, so the walk takes one indexed read per layer. The
+     cache takes 3 bytes per matrix position, it can be left out with the
+     following line in config.h:
+        #define SPARSE_NO_RESOLVE
+ */
+
+#include QMK_KEYBOARD_H
+#include "keymap-sparse.h"
+
+#ifndef SPARSE_LAYERS_H
+#define SPARSE_LAYERS_H "ethanharstad-layers.h"
+#endif
+#include SPARSE_LAYERS_H
+
+_Static_assert(SPARSE_ROWS == MATRIX_ROWS && SPARSE_COLS == MATRIX_COLS, "Sparse layers are for another matrix");
+#ifdef LAYER_COUNT
+_Static_assert(LAYER_COUNT == SPARSE_LAYERS, "Layer names in config.h are for another keymap");
+#endif
+
+static uint8_t count_bits(uint8_t bits)
+{
+    uint8_t count = 0;
+    for (; bits; bits &= bits - 1)
+    {
+        ++count;
+    }
+    return count;
+}
+
+uint16_t sparse_keycode(uint8_t const layer, uint8_t const row, uint8_t const col)
+{
+    if (layer >= SPARSE_LAYERS)
+    {
+        return KC_TRNS;
+    }
+    if (row >= MATRIX_ROWS || col >= MATRIX_COLS)
+    {
+        return KC_NO;
+    }
+
+    sparse_layer_t const *sparse = &sparse_layers[layer];
+    uint8_t const index = row * MATRIX_COLS + col;
+    uint8_t const bits = pgm_read_byte(&sparse->defined[index / 8]);
+    uint8_t const bit = 1 << (index % 8);
+    if (!(bits & bit))
+    {
+        return pgm_read_word(&sparse->fill);
+    }
+
+    // Keycodes of the layer are packed in position order
+    uint16_t const at = pgm_read_word(&sparse->offset) + pgm_read_byte(&sparse->rank[index / 8]) +
+                        count_bits(bits & (bit - 1));
+    return pgm_read_word(&sparse_keycodes[at]);
+}
+
+#ifndef SPARSE_NO_RESOLVE
+// Where the walk down the layers stops for each position under
+// resolved_state, and the keycode there. Positions are resolved on
+// their first lookup after a layer change.
+static layer_state_t resolved_state = 0;
+static uint8_t resolved[SPARSE_BYTES];
+static uint8_t resolved_layers[MATRIX_ROWS * MATRIX_COLS];
+static uint16_t resolved_keycodes[MATRIX_ROWS * MATRIX_COLS];
+
+static void resolve(uint8_t const index, layer_state_t const state)
+{
+    uint8_t const row = index / MATRIX_COLS;
+    uint8_t const col = index % MATRIX_COLS;
+    int8_t layer = SPARSE_LAYERS - 1;
+
+    // As layer_switch_get_layer(), layer 0 when every layer is KC_TRNS
+    for (; layer > 0; --layer)
+    {
+        if (state & (layer_state_t)1 << layer && sparse_keycode(layer, row, col) != KC_TRNS)
+        {
+            break;
+        }
+    }
+    resolved_layers[index] = layer;
+    resolved_keycodes[index] = sparse_keycode(layer, row, col);
+    resolved[index / 8] |= 1 << (index % 8);
+}
+#endif
+
+// Replaces QMK's weak lookup into the dense 'keymaps' array
+uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key)
+{
+#ifndef SPARSE_NO_RESOLVE
+    layer_state_t const state = layer_state | default_layer_state;
+    if (layer >= SPARSE_LAYERS || key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS)
+    {
+        return sparse_keycode(layer, key.row, key.col);
+    }
+    if (state != resolved_state)
+    {
+        resolved_state = state;
+        memset(resolved, 0, sizeof(resolved));
+    }
+
+    uint8_t const index = key.row * MATRIX_COLS + key.col;
+    if (!(resolved[index / 8] & 1 << (index % 8)))
+    {
+        resolve(index, state);
+    }
+    // Still the keycode of the layer asked for. Active layers above the
+    // resolved one are KC_TRNS, others are looked up, as for a release
+    // after the layer state changed.
+    if (layer == resolved_layers[index])
+    {
+        return resolved_keycodes[index];
+    }
+    if (layer > resolved_layers[index] && state & (layer_state_t)1 << layer)
+    {
+        return KC_TRNS;
+    }
+#endif
+    return sparse_keycode(layer, key.row, key.col);
+}
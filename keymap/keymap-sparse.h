@@ -0,0 +1,20 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+#pragma once
+
+#define SPARSE_BYTES ((MATRIX_ROWS * MATRIX_COLS + 7) / 8)
+
+// Keymap layer generated by "sparse.c". Positions are numbered
+// row * MATRIX_COLS + col, and each one in the bitmap takes the next
+// keycode of the layer from 'sparse_keycodes'.
+typedef struct
+{
+    uint16_t fill;                 // Keycode of positions not in the bitmap
+    uint16_t offset;               // First keycode of the layer
+    uint8_t defined[SPARSE_BYTES]; // Bitmap of positions with other keycodes
+    uint8_t rank[SPARSE_BYTES];    // Bits set before each bitmap byte
+} sparse_layer_t;
+
+// Keycode of a matrix position on a layer, KC_TRNS above the last layer
+uint16_t sparse_keycode(uint8_t const layer, uint8_t const row, uint8_t const col);
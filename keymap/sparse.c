@@ -0,0 +1,438 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Sparse keymap compiler. Reads a QMK Configurator keymap export and
+   writes a header of "keymap-sparse.h" layers for the lookup hook in
+   "keymap-sparse.c". Every layer keeps its most common keycode as a
+   fill, a bitmap of the matrix positions holding anything else and a
+   packed list of those keycodes, so flash scales with the keys actually
+   defined. A flash report against dense layers is printed to stderr.
+
+   Build and run from the userspace root:
+        cc -O2 -o sparse keymap/sparse.c
+        ./sparse [-n names -c header] [-o header] keymap.json
+
+   -o header  Output file, defaults to stdout
+   -n names   Comma separated layer names, one per layer of the export
+   -c header  Layer constants from the names for config.h: a number and
+              a layer_state mask per name, LAYER_COUNT and
+              LAYER_HIGHEST_TABLE, the highest layer of every state
+
+   Layer keycodes such as MO(n) are checked against the layers of the
+   export, so a keycode can't switch to a layer that doesn't exist.
+
+   Both headers record the POSIX 'cksum' of the export and stops
+   the build with #error when KEYMAP_JSON_CKSUM differs, as rules.mk
+   defines it from the export on every build. A header left behind
+   after a keymap change fails to compile instead of flashing old keys
+   or layer numbers.
+
+   Keycodes are copied as written, so the header is only compiled by
+   the QMK build. Keys are placed in the matrix through the LAYOUT macro
+   of the keyboard, only "lily58/rev1" is known so far.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_LAYERS 32
+#define MAX_KEYS 128
+#define MAX_KEYCODE 32
+#define MAX_JSON 0x10000
+#define MAX_NAME 16
+#define MAX_HIGHEST 8 // Layers covered by LAYER_HIGHEST_TABLE
+
+typedef char keycode_t[MAX_KEYCODE];
+
+typedef struct
+{
+    const char *keyboard;
+    const char *layout;
+    int rows;
+    int cols;
+    int count;
+    unsigned char matrix[MAX_KEYS][2]; // Row and column of each LAYOUT argument
+} board_t;
+
+// LAYOUT of lily58/rev1, the right half is wired mirrored
+static const board_t boards[] = {
+    {"lily58/rev1", "LAYOUT", 10, 6, 58,
+     {{0, 0}, {0, 1}, {0, 2}, {0, 3}, {0, 4}, {0, 5}, {5, 5}, {5, 4}, {5, 3}, {5, 2}, {5, 1}, {5, 0},
+      {1, 0}, {1, 1}, {1, 2}, {1, 3}, {1, 4}, {1, 5}, {6, 5}, {6, 4}, {6, 3}, {6, 2}, {6, 1}, {6, 0},
+      {2, 0}, {2, 1}, {2, 2}, {2, 3}, {2, 4}, {2, 5}, {7, 5}, {7, 4}, {7, 3}, {7, 2}, {7, 1}, {7, 0},
+      {3, 0}, {3, 1}, {3, 2}, {3, 3}, {3, 4}, {3, 5}, {4, 5}, {9, 5}, {8, 5}, {8, 4}, {8, 3}, {8, 2}, {8, 1}, {8, 0},
+      {4, 1}, {4, 2}, {4, 3}, {4, 4}, {9, 4}, {9, 3}, {9, 2}, {9, 1}}},
+};
+
+typedef struct
+{
+    keycode_t keys[MAX_KEYS]; // Matrix order, positions outside LAYOUT are KC_NO
+    const char *fill;
+    int defined;
+} layer_t;
+
+static char json[MAX_JSON];
+static unsigned long json_cksum;
+static char names[MAX_LAYERS][MAX_NAME];
+static int name_count = 0;
+static layer_t layers[MAX_LAYERS];
+static int layer_count = 0;
+
+// Copy the string value of key from the top level of the export
+static int json_string(const char *key, char *output, size_t n)
+{
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"%s\"", key);
+    const char *at = strstr(json, pattern);
+    if (!at || !(at = strchr(at + strlen(pattern), '"')))
+        return -1;
+    const char *end = strchr(++at, '"');
+    if (!end || (size_t)(end - at) >= n)
+        return -1;
+    snprintf(output, n, "%.*s", (int)(end - at), at);
+    return 0;
+}
+
+// Parse the "layers" array of string arrays into LAYOUT order keycodes
+static int json_layers(keycode_t keys[][MAX_KEYS], int *counts)
+{
+    const char *at = strstr(json, "\"layers\"");
+    int depth = 0;
+
+    if (!at || !(at = strchr(at, '[')))
+        return -1;
+    for (; *at; at++)
+    {
+        if (*at == '[')
+        {
+            if (++depth == 2)
+            {
+                if (layer_count == MAX_LAYERS)
+                    return -1;
+                counts[layer_count] = 0;
+            }
+        }
+        else if (*at == ']')
+        {
+            if (depth-- == 2)
+                layer_count++;
+            if (!depth)
+                return 0;
+        }
+        else if (*at == '"' && depth == 2)
+        {
+            const char *end = strchr(++at, '"');
+            int *count = &counts[layer_count];
+            if (!end || end - at >= MAX_KEYCODE || *count == MAX_KEYS)
+                return -1;
+            snprintf(keys[layer_count][(*count)++], MAX_KEYCODE, "%.*s", (int)(end - at), at);
+            at = end;
+        }
+    }
+    return -1;
+}
+
+// Split the -n argument into names, which must be C identifiers
+static int parse_names(const char *argument)
+{
+    static char list[MAX_LAYERS * MAX_NAME];
+    snprintf(list, sizeof(list), "%s", argument);
+    for (char *name = strtok(list, ","); name; name = strtok(NULL, ","))
+    {
+        if (name_count == MAX_LAYERS || strlen(name) >= MAX_NAME || !(isalpha(*name) || *name == '_'))
+            return -1;
+        for (const char *c = name; *c; c++)
+            if (!isalnum(*c) && *c != '_')
+                return -1;
+        strcpy(names[name_count++], name);
+    }
+    return name_count ? 0 : -1;
+}
+
+// Target layer of a layer keycode such as MO(n) or LT(n, kc), else -1
+static int layer_target(const char *keycode)
+{
+    static const char *const prefixes[] = {"MO(", "TG(", "TO(", "TT(", "DF(", "OSL(", "LT(", "LM("};
+    for (size_t p = 0; p < sizeof(prefixes) / sizeof(prefixes[0]); p++)
+        if (!strncmp(keycode, prefixes[p], strlen(prefixes[p])))
+            return atoi(keycode + strlen(prefixes[p]));
+    return -1;
+}
+
+// Most common keycode of a layer, the first to reach it on a tie
+static const char *layer_fill(const layer_t *layer, int n)
+{
+    const char *fill = layer->keys[0];
+    int best = 0;
+    for (int i = 0; i < n; i++)
+    {
+        int count = 0;
+        for (int j = 0; j < n; j++)
+            count += !strcmp(layer->keys[i], layer->keys[j]);
+        if (count > best)
+        {
+            best = count;
+            fill = layer->keys[i];
+        }
+    }
+    return fill;
+}
+
+// Look a position up the way "keymap-sparse.c" does, from the bitmap
+// and rank bytes, to check the packed lists before writing them
+static const char *sparse_lookup(int l, int index, const unsigned char *bitmap, const unsigned char *rank,
+                                 const int *offsets, keycode_t const *packed)
+{
+    unsigned char const bits = bitmap[index / 8];
+    unsigned char const bit = 1 << (index % 8);
+    if (!(bits & bit))
+        return layers[l].fill;
+    return packed[offsets[l] + rank[index / 8] + __builtin_popcount(bits & (bit - 1))];
+}
+
+// CRC of POSIX 'cksum', over the data and then its length
+static unsigned long cksum(const unsigned char *data, size_t length)
+{
+    unsigned long crc = 0;
+    unsigned char size[sizeof(length)];
+    size_t size_bytes = 0;
+
+    for (size_t n = length; n; n >>= 8)
+        size[size_bytes++] = n & 0xff;
+    for (size_t i = 0; i < length + size_bytes; i++)
+    {
+        crc ^= (unsigned long)(i < length ? data[i] : size[i - length]) << 24;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x80000000UL ? crc << 1 ^ 0x04c11db7UL : crc << 1) & 0xffffffffUL;
+    }
+    return ~crc & 0xffffffffUL;
+}
+
+// Stop a build whose rules.mk checksums another export
+static void write_check(FILE *out, const char *json_path)
+{
+    fprintf(out, "// 'cksum' of %s, KEYMAP_JSON_CKSUM is defined by rules.mk\n", json_path);
+    fprintf(out, "#if defined(KEYMAP_JSON_CKSUM) && KEYMAP_JSON_CKSUM != %lu\n", json_cksum);
+    fprintf(out, "#error \"Generated from another %s, regenerate with the command above\"\n", json_path);
+    fprintf(out, "#endif\n\n");
+}
+
+static void write_banner(FILE *out, int argc, char *argv[])
+{
+    fprintf(out, "// Generated by \"sparse.c\", do not edit. Regenerate with:\n//");
+    for (int i = 0; i < argc; i++)
+        fprintf(out, " %s", i ? argv[i] : "./sparse");
+    fprintf(out, "\n\n#pragma once\n\n");
+}
+
+// Layer numbers and masks, plain defines as config.h is read by the
+// preprocessor before any QMK type exists
+static int write_constants(const char *path, const char *json_path, int argc, char *argv[])
+{
+    FILE *out = fopen(path, "w");
+    if (!out)
+    {
+        perror(path);
+        return 1;
+    }
+    write_banner(out, argc, argv);
+    write_check(out, json_path);
+    for (int l = 0; l < layer_count; l++)
+        fprintf(out, "#define %s %d\n", names[l], l);
+    fprintf(out, "#define LAYER_COUNT %d\n\n", layer_count);
+    for (int l = 0; l < layer_count; l++)
+        fprintf(out, "#define %s_MASK (1UL << %s)\n", names[l], names[l]);
+
+    // Index with (layer_state | default_layer_state) masked to the
+    // layers, as get_highest_layer() with layer 0 for no bits
+    if (layer_count <= MAX_HIGHEST)
+    {
+        fprintf(out, "\n// Highest layer of every layer state\n");
+        fprintf(out, "#define LAYER_STATE_MASK ((1UL << LAYER_COUNT) - 1)\n");
+        fprintf(out, "#define LAYER_HIGHEST_TABLE {");
+        for (int state = 0; state < 1 << layer_count; state++)
+        {
+            int highest = 0;
+            for (int l = 0; l < layer_count; l++)
+                if (state >> l & 1)
+                    highest = l;
+            fprintf(out, "%s%d", state ? ", " : "", highest);
+        }
+        fprintf(out, "}\n");
+    }
+    fclose(out);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    static keycode_t layout_keys[MAX_LAYERS][MAX_KEYS];
+    static keycode_t packed[MAX_LAYERS * MAX_KEYS];
+    static unsigned char bitmaps[MAX_LAYERS][MAX_KEYS / 8];
+    static unsigned char ranks[MAX_LAYERS][MAX_KEYS / 8];
+    int counts[MAX_LAYERS];
+    int offsets[MAX_LAYERS];
+    char keyboard[64];
+    char layout[64];
+    const char *out_path = NULL;
+    const char *constants_path = NULL;
+    FILE *out = stdout;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:n:c:")) != -1)
+    {
+        if (opt == 'o')
+            out_path = optarg;
+        else if (opt == 'c')
+            constants_path = optarg;
+        else if (opt != 'n' || parse_names(optarg))
+        {
+            if (opt == 'n')
+                fprintf(stderr, "%s: expected comma separated C identifiers\n", optarg);
+            else
+                fprintf(stderr, "usage: %s [-n names -c header] [-o header] keymap.json\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind != argc - 1 || !constants_path != !name_count)
+    {
+        fprintf(stderr, "usage: %s [-n names -c header] [-o header] keymap.json\n", argv[0]);
+        return 1;
+    }
+
+    FILE *file = fopen(argv[optind], "r");
+    if (!file)
+    {
+        perror(argv[optind]);
+        return 1;
+    }
+    size_t length = fread(json, 1, sizeof(json) - 1, file);
+    fclose(file);
+    json[length] = '\0';
+    json_cksum = cksum((const unsigned char *)json, length);
+
+    if (json_string("keyboard", keyboard, sizeof(keyboard)) || json_string("layout", layout, sizeof(layout)) ||
+        json_layers(layout_keys, counts) || !layer_count)
+    {
+        fprintf(stderr, "%s: expected a QMK Configurator export with keyboard, layout and layers\n", argv[optind]);
+        return 1;
+    }
+    if (name_count && name_count != layer_count)
+    {
+        fprintf(stderr, "%s: %d layer names for %d layers\n", argv[optind], name_count, layer_count);
+        return 1;
+    }
+    for (int l = 0; l < layer_count; l++)
+    {
+        for (int k = 0; k < counts[l]; k++)
+        {
+            int const target = layer_target(layout_keys[l][k]);
+            if (target >= layer_count)
+            {
+                fprintf(stderr, "%s: %s on layer %d, there are %d layers\n", argv[optind], layout_keys[l][k], l,
+                        layer_count);
+                return 1;
+            }
+        }
+    }
+    const board_t *board = NULL;
+    for (size_t b = 0; b < sizeof(boards) / sizeof(boards[0]); b++)
+        if (!strcmp(boards[b].keyboard, keyboard) && !strcmp(boards[b].layout, layout))
+            board = &boards[b];
+    if (!board)
+    {
+        fprintf(stderr, "%s: unknown keyboard %s with %s\n", argv[optind], keyboard, layout);
+        return 1;
+    }
+
+    // Place keys in the matrix, then pack everything but the fill
+    const int positions = board->rows * board->cols;
+    const int bytes = (positions + 7) / 8;
+    int total = 0;
+    for (int l = 0; l < layer_count; l++)
+    {
+        layer_t *layer = &layers[l];
+        if (counts[l] != board->count)
+        {
+            fprintf(stderr, "%s: layer %d has %d keys, %s takes %d\n", argv[optind], l, counts[l], layout,
+                    board->count);
+            return 1;
+        }
+        for (int i = 0; i < positions; i++)
+            strcpy(layer->keys[i], "KC_NO");
+        for (int k = 0; k < board->count; k++)
+            strcpy(layer->keys[board->matrix[k][0] * board->cols + board->matrix[k][1]], layout_keys[l][k]);
+
+        layer->fill = layer_fill(layer, positions);
+        layer->defined = 0;
+        offsets[l] = total;
+        for (int i = 0; i < positions; i++)
+        {
+            if (i % 8 == 0)
+                ranks[l][i / 8] = layer->defined;
+            if (strcmp(layer->keys[i], layer->fill))
+            {
+                bitmaps[l][i / 8] |= 1 << (i % 8);
+                strcpy(packed[total++], layer->keys[i]);
+                layer->defined++;
+            }
+        }
+        for (int i = 0; i < positions; i++)
+        {
+            if (strcmp(sparse_lookup(l, i, bitmaps[l], ranks[l], offsets, packed), layer->keys[i]))
+            {
+                fprintf(stderr, "Error: layer %d position %d does not look up to %s\n", l, i, layer->keys[i]);
+                return 1;
+            }
+        }
+    }
+
+    if (out_path && !(out = fopen(out_path, "w")))
+    {
+        perror(out_path);
+        return 1;
+    }
+    write_banner(out, argc, argv);
+    write_check(out, argv[optind]);
+    fprintf(out, "#define SPARSE_LAYERS %d\n", layer_count);
+    fprintf(out, "#define SPARSE_ROWS %d\n", board->rows);
+    fprintf(out, "#define SPARSE_COLS %d\n\n", board->cols);
+
+    fprintf(out, "static uint16_t const sparse_keycodes[] PROGMEM = {");
+    for (int l = 0; l < layer_count; l++)
+    {
+        fprintf(out, "%s\n    // Layer %d, %d keys over %s", l ? "," : "", l, layers[l].defined, layers[l].fill);
+        for (int k = 0; k < layers[l].defined; k++)
+            fprintf(out, "%s%s%s", k % 8 ? " " : "\n    ", packed[offsets[l] + k], k < layers[l].defined - 1 ? "," : "");
+    }
+    fprintf(out, "\n};\n\n");
+
+    fprintf(out, "static sparse_layer_t const sparse_layers[SPARSE_LAYERS] PROGMEM = {\n");
+    for (int l = 0; l < layer_count; l++)
+    {
+        fprintf(out, "    {%s, %d, {", layers[l].fill, offsets[l]);
+        for (int b = 0; b < bytes; b++)
+            fprintf(out, "%s0x%02x", b ? ", " : "", bitmaps[l][b]);
+        fprintf(out, "}, {");
+        for (int b = 0; b < bytes; b++)
+            fprintf(out, "%s%d", b ? ", " : "", ranks[l][b]);
+        fprintf(out, "}},\n");
+    }
+    fprintf(out, "};\n");
+    if (out != stdout)
+        fclose(out);
+    if (constants_path && write_constants(constants_path, argv[optind], argc, argv))
+        return 1;
+
+    // Fill and offset words, bitmap and rank bytes per layer
+    size_t dense = 2 * layer_count * positions;
+    size_t sparse = 2 * total + layer_count * (4 + 2 * bytes);
+    fprintf(stderr, "%-6s %6s  %s\n", "layer", "keys", "fill");
+    for (int l = 0; l < layer_count; l++)
+        fprintf(stderr, "%-6d %6d  %s\n", l, layers[l].defined, layers[l].fill);
+    fprintf(stderr, "dense %zu bytes, sparse %zu bytes\n", dense, sparse);
+    return 0;
+}
@@ -0,0 +1,75 @@
+// Generated by "rle.c", do not edit. Regenerate with:
+// ./rle -d 6000 -m oled/bongocat-frames.manifest -o oled/bongocat-frames.h idle=oled/assets/bongocat-idle.pbm@0,0,1,2,3 paws=oled/assets/bongocat-paws.pbm tap=oled/assets/bongocat-tap.pbm
+
+#pragma once
+
+static unsigned char const idle[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x05, 0x00, 0x0f, 0x00, 0x9d, 0x00, 0xa8, 0x00, 0xc5, 0x00, 0xe3, 0x00, 0x3e, 0x01,
+    // Frame 0, rle
+    0x01, 0x3a, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, 0x20, 0x05, 0x10, 0x02, 0x08, 0x03, 0x04, 0x84,
+    0x08, 0x30, 0x40, 0x80, 0x2e, 0x00, 0x03, 0x80, 0x31, 0x00, 0x83, 0x18, 0x64, 0x82, 0x05, 0x02,
+    0x01, 0x01, 0x04, 0x00, 0x02, 0x80, 0x09, 0x00, 0x8f, 0x80, 0x00, 0x30, 0x30, 0x00, 0xc0, 0xc1,
+    0xc1, 0xc2, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x03, 0x00, 0x04, 0x80, 0x04, 0x40, 0x04, 0x20,
+    0x04, 0x10, 0x05, 0x08, 0x05, 0x04, 0x04, 0x02, 0x04, 0x01, 0x33, 0x00, 0x84, 0xc0, 0x38, 0x04,
+    0x03, 0x07, 0x00, 0x03, 0x0c, 0x88, 0x0d, 0x01, 0x00, 0x40, 0xa0, 0x21, 0x22, 0x12, 0x03, 0x11,
+    0x01, 0x09, 0x04, 0x08, 0x02, 0x04, 0x02, 0x08, 0x05, 0x10, 0x82, 0x11, 0x0f, 0x02, 0x01, 0x36,
+    0x00, 0x05, 0x80, 0x05, 0x40, 0x05, 0x20, 0x05, 0x10, 0x05, 0x08, 0x05, 0x04, 0x82, 0x02, 0x03,
+    0x02, 0x02, 0x06, 0x01, 0x02, 0x02, 0x02, 0x04, 0x05, 0x08, 0x01, 0x07, 0x3d, 0x00,
+    // Frame 1, delta
+    0x02, 0x04, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+    // Frame 2, delta
+    0x02, 0x45, 0x00, 0x83, 0x18, 0x00, 0x0c, 0x03, 0x06, 0x82, 0x0c, 0x08, 0x64, 0x00, 0x84, 0x04,
+    0x86, 0x83, 0x03, 0x7b, 0x00, 0x83, 0x40, 0x48, 0x08, 0x4e, 0x00, 0x7f, 0x00,
+    // Frame 3, delta
+    0x02, 0x33, 0x00, 0x02, 0x80, 0x11, 0x00, 0x85, 0x0c, 0x06, 0x03, 0x03, 0x00, 0x02, 0x08, 0x64,
+    0x00, 0x82, 0x02, 0x03, 0x02, 0x01, 0x02, 0x03, 0x4b, 0x00, 0x7f, 0x00, 0x7f, 0x00,
+    // Frame 4, delta
+    0x02, 0x33, 0x00, 0x02, 0x80, 0x05, 0x00, 0x01, 0x80, 0x02, 0xc0, 0x04, 0x60, 0x04, 0x30, 0x8a,
+    0x18, 0x0c, 0x06, 0x03, 0x03, 0x06, 0x14, 0x50, 0xc0, 0x80, 0x62, 0x00, 0x8a, 0x22, 0x23, 0x01,
+    0x01, 0x03, 0x03, 0x06, 0x06, 0x03, 0x01, 0x03, 0x00, 0x02, 0x80, 0x09, 0x00, 0x8f, 0x80, 0x00,
+    0x50, 0x50, 0x00, 0x41, 0x43, 0x43, 0x46, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, 0x5a, 0x00, 0x82,
+    0x15, 0x05, 0x07, 0x00, 0x03, 0x14, 0x82, 0x16, 0x02, 0x03, 0x00, 0x01, 0x03, 0x02, 0x06, 0x03,
+    0x03, 0x01, 0x02, 0x04, 0x00, 0x04, 0x01, 0x2f, 0x00, 0x7f, 0x00};
+_Static_assert(sizeof(idle) == 318, "idle does not match its offset table");
+
+static unsigned char const paws[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x01, 0x00, 0x07, 0x00, 0x98, 0x00,
+    // Frame 0, rle
+    0x01, 0x33, 0x00, 0x02, 0x80, 0x05, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, 0x20, 0x04, 0x10, 0x8a,
+    0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x0c, 0x30, 0x40, 0x80, 0x2e, 0x00, 0x03, 0x80, 0x31, 0x00,
+    0x89, 0x1e, 0xe1, 0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x81, 0x02, 0x80, 0x02, 0x00, 0x02, 0x80,
+    0x09, 0x00, 0x90, 0x80, 0x00, 0x30, 0x30, 0x00, 0x00, 0x01, 0xe1, 0x1a, 0x06, 0x09, 0x31, 0x35,
+    0x01, 0x8a, 0x7c, 0x02, 0x00, 0x04, 0x80, 0x04, 0x40, 0x04, 0x20, 0x04, 0x10, 0x05, 0x08, 0x05,
+    0x04, 0x04, 0x02, 0x04, 0x01, 0x33, 0x00, 0x96, 0x80, 0x70, 0x0c, 0x03, 0x00, 0x00, 0x18, 0x06,
+    0x05, 0x98, 0x99, 0x84, 0xc3, 0x7c, 0x41, 0x41, 0x40, 0x40, 0x20, 0x21, 0x22, 0x12, 0x03, 0x11,
+    0x01, 0x09, 0x04, 0x08, 0x06, 0x04, 0x03, 0x02, 0x04, 0x01, 0x36, 0x00, 0x05, 0x80, 0x05, 0x40,
+    0x05, 0x20, 0x05, 0x10, 0x05, 0x08, 0x05, 0x04, 0x82, 0x02, 0x03, 0x02, 0x02, 0x06, 0x01, 0x47,
+    0x00};
+_Static_assert(sizeof(paws) == 152, "paws does not match its offset table");
+
+static unsigned char const tap[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0xb7, 0x00, 0x17, 0x01,
+    // Frame 0, rle
+    0x01, 0x33, 0x00, 0x02, 0x80, 0x05, 0x00, 0x01, 0x80, 0x02, 0x40, 0x04, 0x20, 0x04, 0x10, 0x8a,
+    0x08, 0x04, 0x02, 0x01, 0x01, 0x02, 0x0c, 0x30, 0x40, 0x80, 0x07, 0x00, 0x04, 0xf8, 0x05, 0x00,
+    0x02, 0x80, 0x1c, 0x00, 0x03, 0x80, 0x31, 0x00, 0x89, 0x1e, 0xe1, 0x00, 0x00, 0x01, 0x01, 0x02,
+    0x02, 0x81, 0x02, 0x80, 0x02, 0x00, 0x02, 0x80, 0x09, 0x00, 0x9a, 0x80, 0x00, 0x30, 0x30, 0x00,
+    0x00, 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x43, 0x87, 0x07, 0x01, 0x00, 0xb8, 0xbc, 0xbe,
+    0x9f, 0x5f, 0x5f, 0x4f, 0x4c, 0x04, 0x20, 0x04, 0x10, 0x05, 0x08, 0x05, 0x04, 0x04, 0x02, 0x04,
+    0x01, 0x33, 0x00, 0x96, 0x80, 0x70, 0x0c, 0x03, 0x00, 0x00, 0x18, 0x06, 0x05, 0x98, 0x99, 0x84,
+    0x43, 0x7c, 0x41, 0x41, 0x40, 0x40, 0x20, 0x21, 0x22, 0x12, 0x03, 0x11, 0x01, 0x09, 0x04, 0x08,
+    0x02, 0x04, 0x02, 0x08, 0x05, 0x10, 0x85, 0x11, 0x0f, 0x01, 0x3d, 0x7c, 0x05, 0xfc, 0x82, 0x3c,
+    0x0c, 0x2e, 0x00, 0x05, 0x80, 0x05, 0x40, 0x05, 0x20, 0x05, 0x10, 0x05, 0x08, 0x05, 0x04, 0x82,
+    0x02, 0x03, 0x02, 0x02, 0x06, 0x01, 0x24, 0x00, 0x01, 0x01, 0x02, 0x03, 0x20, 0x00,
+    // Frame 1, delta
+    0x02, 0x56, 0x00, 0x04, 0xf8, 0x05, 0x00, 0x02, 0x80, 0x58, 0x00, 0x03, 0x80, 0x14, 0x00, 0x8e,
+    0xe0, 0x18, 0x02, 0x01, 0x21, 0x15, 0x42, 0x0d, 0x7b, 0x01, 0x00, 0x38, 0x3c, 0x3e, 0x03, 0x1f,
+    0x82, 0x0f, 0x0c, 0x53, 0x00, 0x88, 0x18, 0x06, 0x05, 0x98, 0x99, 0x84, 0x43, 0x7c, 0x03, 0x40,
+    0x82, 0x00, 0x80, 0x0d, 0x00, 0x02, 0x0c, 0x02, 0x14, 0x03, 0x12, 0x85, 0x10, 0x0e, 0x00, 0x3c,
+    0x7c, 0x05, 0xfc, 0x82, 0x3c, 0x0c, 0x4e, 0x00, 0x06, 0x78, 0x82, 0x38, 0x30, 0x02, 0x02, 0x02,
+    0x04, 0x03, 0x08, 0x02, 0x88, 0x82, 0x87, 0x80, 0x19, 0x00, 0x01, 0x01, 0x02, 0x03, 0x20, 0x00};
+_Static_assert(sizeof(tap) == 279, "tap does not match its offset table");
+
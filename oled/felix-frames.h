@@ -0,0 +1,83 @@
+// Generated by "rle.c", do not edit. Regenerate with:
+// ./rle -m oled/felix-frames.manifest -s 32x24 -o oled/felix-frames.h sit=oled/assets/felix.pbm@0,1 walk=oled/assets/felix.pbm@2,3 run=oled/assets/felix.pbm@4,5 bark=oled/assets/felix.pbm@6,7 sneak=oled/assets/felix.pbm@8,9
+
+#pragma once
+
+static unsigned char const sit[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x42, 0x00, 0x5e, 0x00,
+    // Frame 0, rle
+    0x01, 0x0e, 0x00, 0x8c, 0xe0, 0xfc, 0xfe, 0xfd, 0xfe, 0xdc, 0xfc, 0xfc, 0xfe, 0x5d, 0xfe, 0xe0,
+    0x0c, 0x00, 0x87, 0xe0, 0xf0, 0xf8, 0x1c, 0xf0, 0xf8, 0xfc, 0x08, 0xff, 0x85, 0xfd, 0xf9, 0xfd,
+    0x7f, 0x03, 0x0c, 0x00, 0x84, 0x01, 0x03, 0x07, 0x0f, 0x02, 0x1f, 0x03, 0x3f, 0x83, 0x37, 0x21,
+    0x13, 0x03, 0x3f, 0x83, 0x0f, 0x11, 0x1f, 0x08, 0x00,
+    // Frame 1, delta
+    0x02, 0x0f, 0x00, 0x8a, 0x02, 0x03, 0x03, 0x02, 0x00, 0x00, 0x02, 0x03, 0x03, 0x02, 0x0c, 0x00,
+    0x85, 0xe0, 0x10, 0x08, 0x04, 0x9c, 0x0c, 0x00, 0x01, 0x08, 0x29, 0x00};
+_Static_assert(sizeof(sit) == 94, "sit does not match its offset table");
+
+static unsigned char const walk[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x4b, 0x00, 0x8c, 0x00,
+    // Frame 0, rle
+    0x01, 0x05, 0x00, 0x97, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0x70, 0x30, 0x20, 0x00, 0x80, 0xc0, 0xc0,
+    0xf0, 0xf8, 0xf4, 0xf8, 0x70, 0xf0, 0xf0, 0xf8, 0x74, 0xf8, 0x80, 0x09, 0x00, 0x85, 0x07, 0x0f,
+    0xff, 0xfd, 0xfe, 0x0d, 0xff, 0x85, 0xf7, 0xe7, 0xf5, 0x1f, 0x0f, 0x0b, 0x00, 0x82, 0x03, 0x1f,
+    0x03, 0x3f, 0x8b, 0x0f, 0x11, 0x1f, 0x1f, 0x03, 0x07, 0x1f, 0x3f, 0x3f, 0x0f, 0x13, 0x02, 0x1f,
+    0x07, 0x00,
+    // Frame 1, rle
+    0x01, 0x06, 0x00, 0x82, 0x80, 0xc0, 0x03, 0xe0, 0x82, 0xc0, 0x80, 0x04, 0x00, 0x84, 0xe0, 0xf0,
+    0xe8, 0xf0, 0x03, 0xe0, 0x83, 0xf0, 0xe8, 0xf0, 0x0a, 0x00, 0x84, 0x1f, 0x3f, 0xfb, 0xfd, 0x07,
+    0xfe, 0x05, 0xff, 0x87, 0xfe, 0xff, 0xef, 0xcf, 0xea, 0x3f, 0x1f, 0x0b, 0x00, 0x03, 0x3f, 0x8f,
+    0x0f, 0x03, 0x07, 0x0f, 0x1f, 0x03, 0x1f, 0x1f, 0x17, 0x0f, 0x1f, 0x3f, 0x3f, 0x33, 0x01, 0x07,
+    0x00};
+_Static_assert(sizeof(walk) == 140, "walk does not match its offset table");
+
+static unsigned char const run[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x4d, 0x00, 0x8c, 0x00,
+    // Frame 0, rle
+    0x01, 0x04, 0x00, 0x82, 0xe0, 0xf0, 0x03, 0xf8, 0x82, 0xb0, 0xa0, 0x06, 0x80, 0x02, 0xc0, 0x8b,
+    0xfc, 0xf4, 0xe4, 0xf8, 0x70, 0xf8, 0xe4, 0xf8, 0x70, 0xc0, 0x80, 0x06, 0x00, 0x82, 0x01, 0x63,
+    0x02, 0xe7, 0x10, 0xff, 0x86, 0xf7, 0x67, 0x37, 0x35, 0x1f, 0x0f, 0x07, 0x00, 0x82, 0x0e, 0x0f,
+    0x04, 0x07, 0x03, 0x03, 0x02, 0x01, 0x02, 0x03, 0x89, 0x07, 0x0f, 0x1f, 0x3f, 0x3b, 0x33, 0x07,
+    0x07, 0x06, 0x05, 0x00,
+    // Frame 1, rle
+    0x01, 0x03, 0x00, 0x84, 0xe0, 0xf0, 0xf0, 0xf8, 0x08, 0x00, 0x03, 0x80, 0x8b, 0xf8, 0xe8, 0xc8,
+    0xf0, 0xe0, 0xf0, 0xc8, 0xf0, 0xe0, 0xc0, 0x80, 0x06, 0x00, 0x83, 0x03, 0x07, 0x0f, 0x02, 0x1f,
+    0x0f, 0xff, 0x87, 0xfe, 0xef, 0xcf, 0x6f, 0x6a, 0x3f, 0x1f, 0x0b, 0x00, 0x90, 0x01, 0x03, 0x0f,
+    0x1f, 0x3f, 0x3f, 0x37, 0x03, 0x1f, 0x3f, 0x3f, 0x1f, 0x0f, 0x1f, 0x3f, 0x01, 0x07, 0x00};
+_Static_assert(sizeof(run) == 140, "run does not match its offset table");
+
+static unsigned char const bark[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x4b, 0x00, 0x73, 0x00,
+    // Frame 0, rle
+    0x01, 0x87, 0x00, 0xc0, 0xe0, 0xf0, 0xf0, 0x30, 0x10, 0x06, 0x00, 0x02, 0x80, 0x8c, 0xc0, 0xfc,
+    0xf4, 0xe4, 0xf8, 0x70, 0xf8, 0xe4, 0xf8, 0x70, 0xc0, 0x80, 0x06, 0x00, 0x83, 0x03, 0x07, 0x0f,
+    0x02, 0x1f, 0x0f, 0xff, 0x02, 0xf7, 0x84, 0x37, 0x35, 0x1f, 0x0f, 0x0c, 0x00, 0x92, 0x01, 0x03,
+    0x0f, 0x1f, 0x3f, 0x3f, 0x37, 0x03, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x3b, 0x33, 0x07, 0x07, 0x06,
+    0x07, 0x00,
+    // Frame 1, delta
+    0x02, 0x87, 0x00, 0x20, 0x10, 0x00, 0x00, 0x30, 0x10, 0x09, 0x00, 0x8c, 0x3c, 0x18, 0x10, 0x1c,
+    0x88, 0x88, 0x1c, 0x1c, 0x88, 0xb0, 0x40, 0x80, 0x19, 0x00, 0x02, 0x08, 0x89, 0x40, 0x02, 0x2a,
+    0x10, 0x0f, 0x20, 0x4a, 0x09, 0x10, 0x20, 0x00};
+_Static_assert(sizeof(bark) == 115, "bark does not match its offset table");
+
+static unsigned char const sneak[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x50, 0x00, 0x93, 0x00,
+    // Frame 0, rle
+    0x01, 0x06, 0x00, 0x01, 0x80, 0x04, 0xc0, 0x01, 0x80, 0x06, 0x00, 0x88, 0xc0, 0x40, 0x40, 0x80,
+    0x00, 0x80, 0x40, 0x80, 0x0a, 0x00, 0x84, 0x1e, 0x3f, 0xff, 0xfb, 0x05, 0xfd, 0x04, 0xfc, 0x8c,
+    0xfe, 0xff, 0xff, 0xfe, 0xff, 0xf7, 0xff, 0x7e, 0x7f, 0x57, 0xfc, 0xf8, 0x09, 0x00, 0x82, 0x03,
+    0x1f, 0x03, 0x3f, 0x86, 0x0f, 0x1f, 0x1f, 0x03, 0x07, 0x1f, 0x03, 0x3f, 0x88, 0x0f, 0x1f, 0x1f,
+    0x07, 0x07, 0x03, 0x03, 0x01, 0x04, 0x00,
+    // Frame 1, delta
+    0x02, 0x0a, 0x00, 0x82, 0x40, 0x80, 0x06, 0x00, 0x89, 0x20, 0xe0, 0x60, 0x40, 0x80, 0x40, 0x60,
+    0x40, 0x80, 0x09, 0x00, 0x83, 0x20, 0x40, 0x08, 0x05, 0x00, 0x01, 0x01, 0x07, 0x00, 0x89, 0x01,
+    0x00, 0x0c, 0x00, 0xc1, 0xc0, 0xfc, 0x02, 0x84, 0x09, 0x00, 0x96, 0x3c, 0x20, 0x00, 0x30, 0x3c,
+    0x08, 0x10, 0x00, 0x1c, 0x00, 0x00, 0x20, 0x30, 0x20, 0x30, 0x20, 0x28, 0x00, 0x04, 0x02, 0x02,
+    0x01, 0x04, 0x00};
+_Static_assert(sizeof(sneak) == 147, "sneak does not match its offset table");
+
@@ -0,0 +1,102 @@
+// Generated by "rle.c", do not edit. Regenerate with:
+// ./rle -m oled/felix-native.manifest -r -c raw,rle,lz -s 32x32 logo=oled/assets/luna-logo.pbm -c raw,rle,delta,lz -s 32x24 -o oled/felix-native.h sit=oled/assets/felix.pbm@0,1 walk=oled/assets/felix.pbm@2,3 run=oled/assets/felix.pbm@4,5 bark=oled/assets/felix.pbm@6,7 sneak=oled/assets/felix.pbm@8,9
+
+#pragma once
+
+static unsigned char const logo[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x20, 0x09, 0x00, 0x6a, 0x00, 0xc6, 0x00,
+    // Frame 0, rle
+    0x01, 0x01, 0xc0, 0x06, 0xe0, 0x02, 0xc0, 0x02, 0x80, 0x05, 0x00, 0x02, 0x08, 0x85, 0x18, 0xf8,
+    0xf0, 0xe0, 0xc0, 0x03, 0x00, 0x88, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00, 0x1f, 0x3f, 0x02, 0x7f,
+    0x09, 0xff, 0x05, 0xfe, 0x03, 0xff, 0x82, 0xbf, 0x1f, 0x03, 0x00, 0x82, 0x2c, 0xb2, 0x03, 0x22,
+    0x04, 0x00, 0x83, 0x1c, 0x3c, 0x78, 0x02, 0xf9, 0x07, 0xfb, 0x06, 0xff, 0x82, 0x3f, 0x0e, 0x03,
+    0x00, 0x85, 0xcb, 0x2c, 0x28, 0x28, 0xc8, 0x09, 0x00, 0x83, 0x09, 0x19, 0x39, 0x02, 0x79, 0x03,
+    0x7d, 0x02, 0x7f, 0x02, 0x3f, 0x82, 0x1f, 0x0f, 0x04, 0x00, 0x86, 0x71, 0x8a, 0x82, 0x8a, 0x71,
+    0x00,
+    // Frame 1, rle
+    0x01, 0x01, 0xc0, 0x06, 0xe0, 0x02, 0xc0, 0x02, 0x80, 0x05, 0x00, 0x02, 0x08, 0x85, 0x18, 0xf8,
+    0xf0, 0xe0, 0xc0, 0x09, 0x00, 0x82, 0x1f, 0x3f, 0x02, 0x7f, 0x09, 0xff, 0x05, 0xfe, 0x03, 0xff,
+    0x8a, 0xbf, 0x1f, 0x00, 0x08, 0x3e, 0x02, 0x0c, 0x9a, 0x28, 0x08, 0x04, 0x00, 0x83, 0x1c, 0x3c,
+    0x78, 0x02, 0xf9, 0x07, 0xfb, 0x06, 0xff, 0x85, 0x3f, 0x0e, 0x00, 0x00, 0xe5, 0x03, 0x25, 0x01,
+    0xe9, 0x0a, 0x00, 0x83, 0x09, 0x19, 0x39, 0x02, 0x79, 0x03, 0x7d, 0x02, 0x7f, 0x02, 0x3f, 0x82,
+    0x1f, 0x0f, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00};
+_Static_assert(sizeof(logo) == 198, "logo does not match its offset table");
+
+static unsigned char const sit[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x46, 0x00, 0x69, 0x00,
+    // Frame 0, rle
+    0x01, 0x01, 0x00, 0x04, 0x80, 0x05, 0xc0, 0x05, 0x80, 0x09, 0x00, 0x82, 0x41, 0xa2, 0x03, 0xff,
+    0x86, 0xee, 0xff, 0xfe, 0xff, 0xf8, 0xfd, 0x06, 0xff, 0x85, 0x7d, 0x3d, 0x3d, 0x7b, 0xb8, 0x04,
+    0x00, 0x03, 0x01, 0x03, 0x03, 0x02, 0x07, 0x83, 0x4f, 0xdf, 0xff, 0x03, 0xbf, 0x03, 0xff, 0x83,
+    0x7e, 0x3f, 0x0f, 0x0e, 0x00, 0x01, 0x01, 0x04, 0x03, 0x01, 0x01, 0x06, 0x00,
+    // Frame 1, delta
+    0x02, 0x82, 0x00, 0x80, 0x16, 0x00, 0x82, 0xc3, 0xe7, 0x09, 0x00, 0x01, 0x02, 0x0d, 0x00, 0x01,
+    0x01, 0x08, 0x00, 0x86, 0xc0, 0x40, 0x40, 0x00, 0x00, 0x40, 0x13, 0x00, 0x82, 0x01, 0x02, 0x03,
+    0x04, 0x08, 0x00};
+_Static_assert(sizeof(sit) == 105, "sit does not match its offset table");
+
+static unsigned char const walk[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x4d, 0x00, 0x91, 0x00,
+    // Frame 0, rle
+    0x01, 0x02, 0x00, 0x82, 0x40, 0xa0, 0x03, 0xe0, 0x86, 0xb0, 0xf0, 0xb0, 0xf0, 0x30, 0x60, 0x03,
+    0xc0, 0x05, 0x80, 0x05, 0x00, 0x86, 0x10, 0x28, 0x7f, 0x7f, 0xff, 0xfb, 0x03, 0xff, 0x01, 0xfe,
+    0x06, 0xff, 0x84, 0x7d, 0x3d, 0x3b, 0x18, 0x06, 0x00, 0x86, 0xf0, 0xf8, 0xe1, 0xc3, 0xbf, 0x7f,
+    0x07, 0xff, 0x03, 0xfb, 0x82, 0xf7, 0x70, 0x07, 0x00, 0x82, 0x01, 0x03, 0x04, 0x07, 0x01, 0x03,
+    0x06, 0x01, 0x06, 0x00,
+    // Frame 1, rle
+    0x01, 0x03, 0x00, 0x82, 0x40, 0xa0, 0x03, 0xe0, 0x89, 0xb0, 0xf0, 0xb0, 0xf0, 0x30, 0x60, 0xc0,
+    0xc0, 0x80, 0x0a, 0x00, 0x82, 0x10, 0x28, 0x03, 0x7f, 0x01, 0xfb, 0x03, 0xff, 0x01, 0xfe, 0x05,
+    0xff, 0x84, 0xfe, 0xde, 0xef, 0x07, 0x07, 0x00, 0x85, 0xe0, 0xf0, 0xf8, 0x80, 0x7f, 0x08, 0xff,
+    0x84, 0xee, 0xe6, 0xc2, 0xc0, 0x08, 0x00, 0x88, 0x01, 0x03, 0x07, 0x07, 0x06, 0x07, 0x07, 0x03,
+    0x08, 0x01, 0x02, 0x00};
+_Static_assert(sizeof(walk) == 145, "walk does not match its offset table");
+
+static unsigned char const run[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x4f, 0x00, 0x8d, 0x00,
+    // Frame 0, rle
+    0x01, 0x02, 0x00, 0x8f, 0x40, 0xa0, 0xb0, 0xf0, 0xf8, 0xec, 0xfc, 0xec, 0xfc, 0x0c, 0xb8, 0xf0,
+    0xc0, 0x80, 0xc0, 0x02, 0xe0, 0x07, 0x00, 0x86, 0x1c, 0x12, 0x1b, 0x1f, 0x7f, 0xfe, 0x0a, 0xff,
+    0x84, 0x3c, 0x1e, 0x0f, 0x07, 0x05, 0x00, 0x84, 0x80, 0xc0, 0xe0, 0x80, 0x0a, 0xff, 0x82, 0xfc,
+    0xe0, 0x08, 0x00, 0x82, 0x03, 0x07, 0x04, 0x0f, 0x8b, 0x07, 0x03, 0x00, 0x00, 0x07, 0x07, 0x03,
+    0x03, 0x07, 0x07, 0x06, 0x04, 0x00,
+    // Frame 1, rle
+    0x01, 0x03, 0x00, 0x8e, 0x80, 0x40, 0x60, 0xf0, 0xf8, 0xec, 0xfc, 0xec, 0xfc, 0x0c, 0xb8, 0xf0,
+    0xc0, 0x80, 0x0a, 0x00, 0x86, 0x38, 0x25, 0x37, 0x3f, 0xff, 0xfe, 0x09, 0xff, 0x02, 0x7f, 0x82,
+    0x7b, 0x31, 0x09, 0x00, 0x01, 0x01, 0x08, 0xff, 0x86, 0x7f, 0x3f, 0x1f, 0x1e, 0x0f, 0x07, 0x05,
+    0x00, 0x82, 0x02, 0x0e, 0x03, 0x1e, 0x02, 0x1f, 0x83, 0x0f, 0x07, 0x03, 0x0b, 0x00};
+_Static_assert(sizeof(run) == 141, "run does not match its offset table");
+
+static unsigned char const bark[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x50, 0x00, 0x77, 0x00,
+    // Frame 0, rle
+    0x01, 0x04, 0x00, 0x02, 0x80, 0x88, 0xc0, 0x60, 0xe0, 0x60, 0xe0, 0x60, 0xc0, 0x80, 0x03, 0x00,
+    0x02, 0x80, 0x07, 0x00, 0x86, 0xe2, 0x95, 0xdd, 0xff, 0xff, 0xf7, 0x03, 0xff, 0x8b, 0xf8, 0xff,
+    0xff, 0xfe, 0xfe, 0xff, 0xff, 0xf3, 0x78, 0x3c, 0x1c, 0x08, 0x00, 0x82, 0x01, 0x07, 0x0a, 0xff,
+    0x84, 0x7c, 0x78, 0x3c, 0x1c, 0x06, 0x00, 0x89, 0x1e, 0x3c, 0x78, 0x78, 0x7f, 0x7f, 0x3f, 0x1f,
+    0x0f, 0x03, 0x03, 0x01, 0x01, 0x07, 0x00,
+    // Frame 1, delta
+    0x02, 0x03, 0x00, 0x8c, 0x80, 0x40, 0x40, 0x20, 0xd0, 0x12, 0xd4, 0x10, 0x56, 0x21, 0x48, 0x04,
+    0x0b, 0x00, 0x86, 0x93, 0xdf, 0xf3, 0x80, 0x00, 0x0c, 0x03, 0x00, 0x84, 0x06, 0x00, 0x00, 0x01,
+    0x25, 0x00, 0x82, 0x26, 0x44, 0x12, 0x00};
+_Static_assert(sizeof(bark) == 119, "bark does not match its offset table");
+
+static unsigned char const sneak[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x48, 0x00, 0x86, 0x00,
+    // Frame 0, rle
+    0x01, 0x06, 0x00, 0x8d, 0x80, 0x40, 0x60, 0xe0, 0xf0, 0xd8, 0xf8, 0xd8, 0xf8, 0x18, 0xf0, 0xe0,
+    0x80, 0x0b, 0x00, 0x86, 0x38, 0x25, 0x37, 0x7f, 0xff, 0xfd, 0x07, 0xff, 0x83, 0xfe, 0xf6, 0x70,
+    0x08, 0x00, 0x84, 0xe0, 0xf0, 0xf8, 0x00, 0x08, 0xff, 0x84, 0xfd, 0xfc, 0xec, 0xe0, 0x08, 0x00,
+    0x88, 0x01, 0x03, 0x07, 0x0f, 0x0e, 0x0f, 0x0f, 0x07, 0x04, 0x03, 0x03, 0x01, 0x03, 0x00,
+    // Frame 1, delta
+    0x02, 0x05, 0x00, 0x86, 0x80, 0xc0, 0x20, 0x80, 0x10, 0x28, 0x03, 0x20, 0x85, 0xe0, 0xe8, 0x10,
+    0x60, 0x80, 0x0a, 0x00, 0x85, 0x38, 0x1d, 0x12, 0x08, 0x00, 0x02, 0x02, 0x07, 0x00, 0x83, 0x02,
+    0x28, 0x7e, 0x08, 0x00, 0x83, 0x20, 0x10, 0x08, 0x09, 0x00, 0x84, 0x22, 0x32, 0x6a, 0x60, 0x0d,
+    0x00, 0x84, 0x02, 0x00, 0x08, 0x04, 0x03, 0x00, 0x03, 0x02, 0x01, 0x03, 0x02, 0x00};
+_Static_assert(sizeof(sneak) == 134, "sneak does not match its offset table");
+
@@ -0,0 +1,548 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* OLED font subsetter and text renderer. Scans userspace sources for
+   the glyphs they write, PROGMEM char arrays and PSTR() literals, and
+   writes a font of only those glyphs with identical glyphs merged, along
+   with a map from character codes to subset glyphs for
+   'oled_write_glyphs_P()' in "oled-icons.c". Static text can instead be
+   drawn here once, into raw bitmaps for 'oled_write_raw_P()', and its
+   glyphs are then left out of the font. Commented out code is not
+   scanned, code under any #ifdef is. A flash report against the full
+   font is printed to stderr.
+
+   Build and run from the userspace root:
+        cc -O2 -o fontsubset oled/fontsubset.c
+        ./fontsubset -o oled/oledfont-subset.c -m oled/oledfont-map.h \
+            -t oled/oled-text.h -r qmk_logo@32 -r layer_icons@32 \
+            -r corne_logo@32 -r corne_label@32 -r katakana@32 \
+            oled/oledfont.c oled/oled-icons.c oled/oled-luna.c
+
+   -o font    Subset font output, to be the OLED_FONT_H of the build
+   -m map     Character map output for "oled-icons.c"
+   -t header  Raw bitmap output for the -r arrays
+   -r name@W  Draw the PROGMEM char array name as 'oled_write_P()' would
+              from the start of a line W pixels wide, 32 for
+              OLED_ROTATION_90 or 270 on a 128x32 OLED. Emits the
+              initializer NAME_RAW and the line count NAME_RAW_LINES,
+              and NAME_RAW_SIZE for arrays of strings, which must all
+              draw to the same size.
+
+   The first file is the full font, the rest are scanned. Subset glyph 0
+   is blank and codes missing from the sources map to it. '\n' and '\r'
+   are never subset glyphs, as the driver's 'oled_write_char()' takes
+   them as line breaks. The subset font stops the build unless
+   OLED_FONT_END is its last glyph, so the driver blanks any code past it.
+
+   Check that nothing changed on screen with the golden test of every
+   pet, review "host/golden.c", built with:
+        -DOLED_FONT_H='"../oled/oledfont-subset.c"' -DOLED_FONT_SUBSET \
+        -DOLED_FONT_END=<last glyph>
+   The goldens are drawn with "oled/oledfont.c", so they compare the
+   subset against that font only. Builds before the subset named no
+   OLED_FONT_H and drew with QMK's default "glcdfont.c", which is not
+   part of this userspace and not compared.
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define FONT_WIDTH 6
+#define MAX_GLYPHS 256
+#define MAX_SOURCE 0x40000
+#define MAX_RENDERS 16
+#define MAX_STRINGS 8
+#define MAX_TEXT 128
+#define MAX_RAW 1024 // 128x64 OLED
+
+typedef struct
+{
+    int length;
+    unsigned char codes[MAX_TEXT];
+    int ended; // Terminator reached, later codes are not drawn
+} text_t;
+
+typedef struct
+{
+    char name[64];
+    int width;
+    int count; // Strings found, 0 until the array is scanned
+    text_t strings[MAX_STRINGS];
+} render_t;
+
+static unsigned char font[MAX_GLYPHS][FONT_WIDTH];
+static int font_count = 0;
+static int used[MAX_GLYPHS];
+static render_t renders[MAX_RENDERS];
+static int render_count = 0;
+
+static char *read_file(const char *path)
+{
+    FILE *file = fopen(path, "r");
+    if (!file)
+    {
+        perror(path);
+        return NULL;
+    }
+    char *text = malloc(MAX_SOURCE);
+    size_t length = fread(text, 1, MAX_SOURCE - 1, file);
+    fclose(file);
+    text[length] = '\0';
+    return text;
+}
+
+// Blank out comments in place, leaving string and character literals
+static void strip_comments(char *text)
+{
+    for (char *at = text; *at; at++)
+    {
+        if (*at == '"' || *at == '\'')
+        {
+            char const quote = *at;
+            for (at++; *at && *at != quote; at++)
+                if (*at == '\\' && at[1])
+                    at++;
+            if (!*at)
+                return;
+        }
+        else if (at[0] == '/' && at[1] == '/')
+        {
+            for (; *at && *at != '\n'; at++)
+                *at = ' ';
+            if (!*at)
+                return;
+        }
+        else if (at[0] == '/' && at[1] == '*')
+        {
+            for (; *at && !(at[0] == '*' && at[1] == '/'); at++)
+                if (*at != '\n')
+                    *at = ' ';
+            if (!*at)
+                return;
+            at[0] = at[1] = ' ';
+            at++;
+        }
+    }
+}
+
+// Value of a number or character literal at text, advancing past it
+static long parse_value(const char **text)
+{
+    const char *at = *text;
+    long value;
+    if (*at == '\'')
+    {
+        value = (unsigned char)at[1];
+        if (at[1] == '\\')
+            value = at[2] == 'x' ? strtol(at + 3, (char **)&at, 16) : at[2] == 'n' ? '\n' : at[2] == '0' ? 0 : at[2];
+        at = strchr(at + 2, '\'');
+        *text = at ? at + 1 : *text + 1;
+        return value;
+    }
+    value = strtol(at, (char **)text, 0);
+    return value;
+}
+
+static void append(text_t *text, long const code)
+{
+    if (code == 0)
+        text->ended = 1;
+    else if (!text->ended && text->length < MAX_TEXT)
+        text->codes[text->length++] = code;
+}
+
+// Append the characters of a C string literal starting at its quote,
+// returning its closing quote
+static const char *parse_string(const char *at, text_t *text)
+{
+    for (at++; *at && *at != '"'; at++)
+    {
+        unsigned char c = *at;
+        if (c == '\\')
+        {
+            at++;
+            if (*at == 'x')
+            {
+                c = strtol(at + 1, (char **)&at, 16);
+                at--;
+            }
+            else
+            {
+                c = *at == 'n' ? '\n' : *at == 'r' ? '\r' : *at == 't' ? '\t' : *at == '0' ? 0 : *at;
+            }
+        }
+        append(text, c);
+    }
+    return at;
+}
+
+// Strings of an initializer: a string literal, a brace list of codes,
+// or a brace list of either for arrays of strings. Returns the count.
+static int parse_initializer(const char *at, text_t *strings)
+{
+    int count = 0;
+    while (isspace((unsigned char)*at))
+        at++;
+    if (*at == '"')
+    {
+        memset(strings, 0, sizeof(*strings));
+        parse_string(at, strings);
+        return 1;
+    }
+    if (*at != '{')
+        return 0;
+
+    text_t *text = NULL;
+    for (int depth = 0; *at; at++)
+    {
+        if (*at == '{' && ++depth <= 2)
+        {
+            // A new string at the outer brace, replaced by nested ones
+            if (count == MAX_STRINGS)
+                return -1;
+            if (depth == 2 && text && !text->length && !text->ended)
+                count--;
+            text = &strings[count++];
+            memset(text, 0, sizeof(*text));
+        }
+        else if (*at == '}' && !--depth)
+            break;
+        else if (*at == '"' && text)
+            at = parse_string(at, text);
+        else if (text && ((isdigit((unsigned char)*at) && !isalnum((unsigned char)at[-1]) && at[-1] != '_') ||
+                          *at == '\''))
+        {
+            long const code = parse_value(&at);
+            if (code >= 0 && code < MAX_GLYPHS)
+                append(text, code);
+            at--;
+        }
+    }
+    return count;
+}
+
+// Mark every glyph written from a source: the initializers of char
+// arrays in PROGMEM, nested braces included, and PSTR() literals. The
+// strings of arrays to render are kept instead.
+static int scan_source(char *text)
+{
+    static text_t strings[MAX_STRINGS];
+
+    strip_comments(text);
+    for (const char *at = strstr(text, "PSTR("); at; at = strstr(at + 5, "PSTR("))
+    {
+        const char *quote = at + 5;
+        while (isspace((unsigned char)*quote))
+            quote++;
+        if (*quote != '"')
+            continue;
+        memset(strings, 0, sizeof(*strings));
+        parse_string(quote, strings);
+        for (int i = 0; i < strings->length; i++)
+            used[strings->codes[i]] = 1;
+    }
+    for (const char *at = strstr(text, "PROGMEM"); at; at = strstr(at + 7, "PROGMEM"))
+    {
+        // Declaration from the end of the last statement or block
+        const char *start = at;
+        while (start > text && !strchr(";{}", start[-1]))
+            start--;
+        const char *const assign = strchr(at, '=');
+        const char *const end = strchr(at, ';');
+        if (!assign || !end || assign > end)
+            continue;
+        char declaration[256];
+        snprintf(declaration, sizeof(declaration), "%.*s", (int)(assign - start), start);
+        char *bracket = strchr(declaration, '[');
+        if (!strstr(declaration, "char") || strstr(declaration, "unsigned") || !bracket)
+            continue;
+
+        // Name before the first bracket
+        char *name = bracket;
+        while (name > declaration && (isalnum((unsigned char)name[-1]) || name[-1] == '_'))
+            name--;
+        *bracket = '\0';
+
+        int const count = parse_initializer(assign + 1, strings);
+        if (count < 0)
+        {
+            fprintf(stderr, "Error: %s has more than %d strings\n", name, MAX_STRINGS);
+            return -1;
+        }
+        render_t *render = NULL;
+        for (int r = 0; r < render_count; r++)
+            if (!strcmp(renders[r].name, name))
+                render = &renders[r];
+        if (render)
+        {
+            render->count = count;
+            memcpy(render->strings, strings, sizeof(strings));
+            continue;
+        }
+        for (int i = 0; i < count; i++)
+            for (int c = 0; c < strings[i].length; c++)
+                used[strings[i].codes[c]] = 1;
+    }
+    return 0;
+}
+
+// Draw a string from the start of a line, advancing and wrapping as
+// the driver's 'oled_write_char()'. Returns the bytes up to the end of
+// the last glyph.
+static int draw_text(const text_t *text, int width, unsigned char *raw)
+{
+    int cursor = 0;
+    int length = 0;
+    memset(raw, 0, MAX_RAW);
+    for (int i = 0; i < text->length; i++)
+    {
+        unsigned char const c = text->codes[i];
+        if (c >= font_count || c == '\n' || c == '\r' || cursor + FONT_WIDTH > MAX_RAW)
+            return -1;
+        memcpy(raw + cursor, font[c], FONT_WIDTH);
+        length = cursor + FONT_WIDTH;
+        cursor = length;
+        if (width - cursor % width < FONT_WIDTH)
+            cursor += width - cursor % width;
+    }
+    return length;
+}
+
+// Initializer macros of the -r arrays
+static int write_text(const char *path, int argc, char *argv[])
+{
+    static unsigned char raw[MAX_RAW];
+    FILE *out = fopen(path, "w");
+    if (!out)
+    {
+        perror(path);
+        return -1;
+    }
+    fprintf(out, "// Generated by \"fontsubset.c\", do not edit. Regenerate with:\n//");
+    for (int i = 0; i < argc; i++)
+        fprintf(out, " %s", i ? argv[i] : "./fontsubset");
+    fprintf(out, "\n\n#pragma once\n");
+
+    int total = 0;
+    for (int r = 0; r < render_count; r++)
+    {
+        render_t const *render = &renders[r];
+        char upper[64];
+        int size = -1;
+        for (int i = 0; i <= (int)strlen(render->name); i++)
+            upper[i] = toupper((unsigned char)render->name[i]);
+
+        fprintf(out, "\n// \"%s\" drawn on %d pixel lines\n", render->name, render->width);
+        for (int i = 0; i < render->count; i++)
+        {
+            int const length = draw_text(&render->strings[i], render->width, raw);
+            if (length < 0 || (size >= 0 && length != size))
+            {
+                fprintf(stderr, "Error: %s %s\n", render->name,
+                        length < 0 ? "has codes the font can't draw" : "strings draw to different sizes");
+                fclose(out);
+                return -1;
+            }
+            if (size < 0)
+            {
+                size = length;
+                fprintf(out, "#define %s_RAW_LINES %d\n", upper, (size + render->width - 1) / render->width);
+                if (render->count > 1)
+                    fprintf(out, "#define %s_RAW_SIZE %d\n", upper, size);
+                fprintf(out, "#define %s_RAW {%s", upper, render->count > 1 ? "{" : "");
+            }
+            else
+            {
+                fprintf(out, "}, {");
+            }
+            for (int b = 0; b < length; b++)
+                fprintf(out, "%s0x%02X", b % 12 ? ", " : b ? ", \\\n    " : " \\\n    ", raw[b]);
+            total += length;
+        }
+        fprintf(out, "%s}\n", render->count > 1 ? "}" : "");
+    }
+    fclose(out);
+    fprintf(stderr, "%d bytes of raw text\n", total);
+    return 0;
+}
+
+// Glyph rows of the font array, six bytes each
+static int parse_font(char *text)
+{
+    strip_comments(text);
+    const char *at = strstr(text, "font[]");
+    if (!at || !(at = strchr(at, '{')))
+        return -1;
+    int bytes = 0;
+    for (at++; *at && *at != '}'; at++)
+    {
+        if (!isdigit((unsigned char)*at))
+            continue;
+        if (bytes == MAX_GLYPHS * FONT_WIDTH)
+            return -1;
+        font[bytes / FONT_WIDTH][bytes % FONT_WIDTH] = strtol(at, (char **)&at, 0);
+        bytes++;
+        at--;
+    }
+    font_count = bytes / FONT_WIDTH;
+    return bytes % FONT_WIDTH || !font_count ? -1 : 0;
+}
+
+int main(int argc, char *argv[])
+{
+    static unsigned char subset[MAX_GLYPHS][FONT_WIDTH];
+    unsigned char map[MAX_GLYPHS] = {0};
+    const char *font_path = NULL;
+    const char *map_path = NULL;
+    const char *text_path = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:m:t:r:")) != -1)
+    {
+        if (opt == 'o')
+            font_path = optarg;
+        else if (opt == 'm')
+            map_path = optarg;
+        else if (opt == 't')
+            text_path = optarg;
+        else if (opt == 'r' && render_count < MAX_RENDERS)
+        {
+            render_t *render = &renders[render_count++];
+            const char *at = strchr(optarg, '@');
+            if (!at || at == optarg || at - optarg >= (int)sizeof(render->name) ||
+                (render->width = atoi(at + 1)) < FONT_WIDTH)
+            {
+                fprintf(stderr, "%s: expected name@width\n", optarg);
+                return 1;
+            }
+            snprintf(render->name, sizeof(render->name), "%.*s", (int)(at - optarg), optarg);
+        }
+        else
+            break;
+    }
+    if (opt != -1 || !font_path || !map_path || !text_path != !render_count || optind > argc - 2)
+    {
+        fprintf(stderr, "usage: %s -o font -m map [-t header -r name@width ...] font.c source.c ...\n", argv[0]);
+        return 1;
+    }
+
+    char *text = read_file(argv[optind]);
+    if (!text)
+        return 1;
+    if (parse_font(text))
+    {
+        fprintf(stderr, "%s: expected a font[] array of %d byte glyphs\n", argv[optind], FONT_WIDTH);
+        return 1;
+    }
+    free(text);
+    for (int i = optind + 1; i < argc; i++)
+    {
+        if (!(text = read_file(argv[i])))
+            return 1;
+        if (scan_source(text))
+            return 1;
+        free(text);
+    }
+    for (int r = 0; r < render_count; r++)
+    {
+        if (!renders[r].count)
+        {
+            fprintf(stderr, "Error: no PROGMEM char array %s in the sources\n", renders[r].name);
+            return 1;
+        }
+    }
+    if (text_path && write_text(text_path, argc, argv))
+        return 1;
+
+    // Glyph 0 is blank, then used glyphs in code order, merging equal
+    // bitmaps and skipping the line break codes
+    int count = 1;
+    int codes = 0;
+    int first = 0;
+    int last = 0;
+    for (int c = 1; c < MAX_GLYPHS; c++)
+    {
+        if (!used[c])
+            continue;
+        codes++;
+        first = first ? first : c;
+        last = c;
+        if (c == '\n' || c == '\r')
+        {
+            map[c] = c;
+            continue;
+        }
+        if (c >= font_count)
+        {
+            fprintf(stderr, "Error: code 0x%02X is written but the font has %d glyphs\n", c, font_count);
+            return 1;
+        }
+        int g = 0;
+        while (g < count && (g == '\n' || g == '\r' || memcmp(subset[g], font[c], FONT_WIDTH)))
+            g++;
+        if (g == count)
+        {
+            while (count == '\n' || count == '\r')
+                count++;
+            g = count++;
+            memcpy(subset[g], font[c], FONT_WIDTH);
+        }
+        map[c] = g;
+    }
+    if (!first)
+        first = last = ' ';
+
+    FILE *out = fopen(font_path, "w");
+    if (!out)
+    {
+        perror(font_path);
+        return 1;
+    }
+    fprintf(out, "// Generated by \"fontsubset.c\", do not edit. Regenerate with:\n//");
+    for (int i = 0; i < argc; i++)
+        fprintf(out, " %s", i ? argv[i] : "./fontsubset");
+    fprintf(out, "\n\n#include \"progmem.h\"\n\n");
+    fprintf(out, "#if OLED_FONT_START != 0 || OLED_FONT_END != %d\n", count - 1);
+    fprintf(out, "#error \"The subset font needs OLED_FONT_START 0 and OLED_FONT_END %d\"\n#endif\n\n", count - 1);
+    fprintf(out, "// Glyphs of \"%s\" written by the userspace, see \"oledfont-map.h\"\n", argv[optind]);
+    fprintf(out, "static unsigned char const font[] PROGMEM = {\n");
+    for (int g = 0; g < count; g++)
+    {
+        fprintf(out, "    ");
+        for (int b = 0; b < FONT_WIDTH; b++)
+            fprintf(out, "0x%02X%s", subset[g][b], g < count - 1 || b < FONT_WIDTH - 1 ? (b < FONT_WIDTH - 1 ? ", " : ",") : "");
+        fprintf(out, "\n");
+    }
+    fprintf(out, "};\n");
+    fclose(out);
+
+    if (!(out = fopen(map_path, "w")))
+    {
+        perror(map_path);
+        return 1;
+    }
+    fprintf(out, "// Generated by \"fontsubset.c\", do not edit. Regenerate with:\n//");
+    for (int i = 0; i < argc; i++)
+        fprintf(out, " %s", i ? argv[i] : "./fontsubset");
+    fprintf(out, "\n\n#pragma once\n\n");
+    if (text_path)
+        fprintf(out, "// Glyphs drawn into \"%s\" are left out\n#define OLED_FONT_MAP_TEXT_RAW\n\n", text_path);
+    fprintf(out, "#define OLED_FONT_MAP_FIRST 0x%02X\n", first);
+    fprintf(out, "#define OLED_FONT_MAP_LAST 0x%02X\n\n", last);
+    fprintf(out, "// Subset glyph of every character code from OLED_FONT_MAP_FIRST\n");
+    fprintf(out, "static uint8_t const font_map[OLED_FONT_MAP_LAST - OLED_FONT_MAP_FIRST + 1] PROGMEM = {");
+    for (int c = first; c <= last; c++)
+        fprintf(out, "%s%d%s", (c - first) % 16 ? " " : "\n    ", map[c], c < last ? "," : "");
+    fprintf(out, "\n};\n");
+    fclose(out);
+
+    int const font_bytes = font_count * FONT_WIDTH;
+    int const subset_bytes = count * FONT_WIDTH + last - first + 1;
+    fprintf(stderr, "%d of %d glyphs used, %d after merging\n", codes, font_count, count);
+    fprintf(stderr, "font %d bytes, subset %d bytes and map %d bytes, %d bytes saved\n", font_bytes, count * FONT_WIDTH,
+            last - first + 1, font_bytes - subset_bytes);
+    return 0;
+}
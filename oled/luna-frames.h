@@ -0,0 +1,83 @@
+// Generated by "rle.c", do not edit. Regenerate with:
+// ./rle -m oled/luna-frames.manifest -s 32x24 -o oled/luna-frames.h sit=oled/assets/luna.pbm@0,1 walk=oled/assets/luna.pbm@2,3 run=oled/assets/luna.pbm@4,5 bark=oled/assets/luna.pbm@6,7 sneak=oled/assets/luna.pbm@8,9
+
+#pragma once
+
+static unsigned char const sit[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x43, 0x00, 0x52, 0x00,
+    // Frame 0, rle
+    0x01, 0x0e, 0x00, 0x8c, 0xe0, 0x1c, 0x02, 0x05, 0x02, 0x24, 0x04, 0x04, 0x02, 0xa9, 0x1e, 0xe0,
+    0x0c, 0x00, 0x88, 0xe0, 0x10, 0x08, 0x68, 0x10, 0x08, 0x04, 0x03, 0x07, 0x00, 0x85, 0x02, 0x06,
+    0x82, 0x7c, 0x03, 0x0c, 0x00, 0x84, 0x01, 0x02, 0x04, 0x0c, 0x02, 0x10, 0x03, 0x20, 0x89, 0x28,
+    0x3e, 0x1c, 0x20, 0x20, 0x3e, 0x0f, 0x11, 0x1f, 0x08, 0x00,
+    // Frame 1, delta
+    0x02, 0x25, 0x00, 0x85, 0xe0, 0x70, 0x18, 0x10, 0x08, 0x0c, 0x00, 0x01, 0x08, 0x29, 0x00};
+_Static_assert(sizeof(sit) == 82, "sit does not match its offset table");
+
+static unsigned char const walk[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x51, 0x00, 0x95, 0x00,
+    // Frame 0, rle
+    0x01, 0x05, 0x00, 0x84, 0x80, 0x40, 0x20, 0x10, 0x03, 0x90, 0x82, 0xa0, 0xc0, 0x03, 0x80, 0x8b,
+    0x70, 0x08, 0x14, 0x08, 0x90, 0x10, 0x10, 0x08, 0xa4, 0x78, 0x80, 0x09, 0x00, 0x84, 0x07, 0x08,
+    0xfc, 0x01, 0x04, 0x00, 0x84, 0x80, 0x00, 0x00, 0x01, 0x06, 0x00, 0x85, 0x08, 0x18, 0xea, 0x10,
+    0x0f, 0x0b, 0x00, 0x92, 0x03, 0x1c, 0x20, 0x20, 0x3c, 0x0f, 0x11, 0x1f, 0x03, 0x06, 0x18, 0x20,
+    0x20, 0x3c, 0x0c, 0x12, 0x1e, 0x01, 0x07, 0x00,
+    // Frame 1, rle
+    0x01, 0x06, 0x00, 0x82, 0x80, 0x40, 0x03, 0x20, 0x82, 0x40, 0x80, 0x04, 0x00, 0x84, 0xe0, 0x10,
+    0x28, 0x10, 0x03, 0x20, 0x83, 0x10, 0x48, 0xf0, 0x0a, 0x00, 0x84, 0x1f, 0x20, 0xf8, 0x02, 0x07,
+    0x01, 0x01, 0x03, 0x04, 0x00, 0x87, 0x01, 0x00, 0x10, 0x30, 0xd5, 0x20, 0x1f, 0x0b, 0x00, 0x92,
+    0x3f, 0x20, 0x30, 0x0c, 0x02, 0x05, 0x09, 0x12, 0x1e, 0x02, 0x1c, 0x14, 0x08, 0x10, 0x20, 0x2c,
+    0x32, 0x01, 0x07, 0x00};
+_Static_assert(sizeof(walk) == 149, "walk does not match its offset table");
+
+static unsigned char const run[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x53, 0x00, 0x95, 0x00,
+    // Frame 0, rle
+    0x01, 0x04, 0x00, 0x86, 0xe0, 0x10, 0x08, 0x08, 0xc8, 0xb0, 0x07, 0x80, 0x02, 0x40, 0x8b, 0x3c,
+    0x14, 0x04, 0x08, 0x90, 0x18, 0x04, 0x08, 0xb0, 0x40, 0x80, 0x06, 0x00, 0x85, 0x01, 0x02, 0xc4,
+    0xa4, 0xfc, 0x04, 0x00, 0x01, 0x80, 0x09, 0x00, 0x87, 0x80, 0xc8, 0x58, 0x28, 0x2a, 0x10, 0x0f,
+    0x07, 0x00, 0x82, 0x0e, 0x09, 0x04, 0x04, 0x90, 0x02, 0x03, 0x02, 0x01, 0x01, 0x02, 0x02, 0x04,
+    0x08, 0x10, 0x26, 0x2b, 0x32, 0x04, 0x05, 0x06, 0x05, 0x00,
+    // Frame 1, rle
+    0x01, 0x03, 0x00, 0x84, 0xe0, 0x10, 0x10, 0xf0, 0x08, 0x00, 0x03, 0x80, 0x8b, 0x78, 0x28, 0x08,
+    0x10, 0x20, 0x30, 0x08, 0x10, 0x20, 0x40, 0x80, 0x06, 0x00, 0x86, 0x03, 0x04, 0x08, 0x10, 0x11,
+    0xf9, 0x06, 0x01, 0x08, 0x00, 0x87, 0x01, 0x10, 0xb0, 0x50, 0x55, 0x20, 0x1f, 0x0b, 0x00, 0x90,
+    0x01, 0x02, 0x0c, 0x10, 0x20, 0x28, 0x37, 0x02, 0x1e, 0x20, 0x20, 0x18, 0x0c, 0x14, 0x1e, 0x01,
+    0x07, 0x00};
+_Static_assert(sizeof(run) == 149, "run does not match its offset table");
+
+static unsigned char const bark[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x4e, 0x00, 0x76, 0x00,
+    // Frame 0, rle
+    0x01, 0x86, 0x00, 0xc0, 0x20, 0x10, 0xd0, 0x30, 0x07, 0x00, 0x02, 0x80, 0x8c, 0x40, 0x3c, 0x14,
+    0x04, 0x08, 0x90, 0x18, 0x04, 0x08, 0xb0, 0x40, 0x80, 0x06, 0x00, 0x86, 0x03, 0x04, 0x08, 0x10,
+    0x11, 0xf9, 0x06, 0x01, 0x07, 0x00, 0x87, 0x80, 0xc8, 0x48, 0x28, 0x2a, 0x10, 0x0f, 0x0c, 0x00,
+    0x92, 0x01, 0x02, 0x0c, 0x10, 0x20, 0x28, 0x37, 0x02, 0x02, 0x04, 0x08, 0x10, 0x26, 0x2b, 0x32,
+    0x04, 0x05, 0x06, 0x07, 0x00,
+    // Frame 1, delta
+    0x02, 0x86, 0x00, 0x20, 0x30, 0x00, 0x20, 0x30, 0x0a, 0x00, 0x8c, 0x7c, 0x38, 0x10, 0x0c, 0x98,
+    0x88, 0x1c, 0x0c, 0xb8, 0xf0, 0xc0, 0x80, 0x18, 0x00, 0x8c, 0x80, 0x48, 0x88, 0x60, 0x02, 0x3a,
+    0x1f, 0x0f, 0x20, 0x4a, 0x09, 0x10, 0x20, 0x00};
+_Static_assert(sizeof(bark) == 118, "bark does not match its offset table");
+
+static unsigned char const sneak[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x00, 0x09, 0x00, 0x53, 0x00, 0x98, 0x00,
+    // Frame 0, rle
+    0x01, 0x06, 0x00, 0x01, 0x80, 0x04, 0x40, 0x01, 0x80, 0x06, 0x00, 0x88, 0xc0, 0x40, 0x40, 0x80,
+    0x00, 0x80, 0x40, 0x80, 0x0a, 0x00, 0x84, 0x1e, 0x21, 0xf0, 0x04, 0x04, 0x02, 0x01, 0x03, 0x02,
+    0x02, 0x03, 0x04, 0x8b, 0x03, 0x01, 0x00, 0x00, 0x09, 0x01, 0x80, 0x80, 0xab, 0x04, 0xf8, 0x09,
+    0x00, 0x96, 0x03, 0x1c, 0x20, 0x20, 0x3c, 0x0f, 0x11, 0x1f, 0x02, 0x06, 0x18, 0x20, 0x20, 0x38,
+    0x08, 0x10, 0x18, 0x04, 0x04, 0x02, 0x02, 0x01, 0x04, 0x00,
+    // Frame 1, delta
+    0x02, 0x0a, 0x00, 0x82, 0xc0, 0x80, 0x06, 0x00, 0x89, 0x20, 0xe0, 0x60, 0xc0, 0x80, 0x40, 0x60,
+    0xc0, 0x80, 0x09, 0x00, 0x82, 0x20, 0x60, 0x05, 0x00, 0x02, 0x01, 0x04, 0x00, 0x8c, 0x06, 0x02,
+    0x01, 0x00, 0x00, 0x0d, 0x01, 0xc0, 0xc0, 0xfe, 0x86, 0x84, 0x09, 0x00, 0x02, 0x3c, 0x8a, 0x10,
+    0x2c, 0x3e, 0x0a, 0x18, 0x0d, 0x1c, 0x02, 0x00, 0x30, 0x03, 0x28, 0x87, 0x38, 0x2c, 0x02, 0x06,
+    0x03, 0x03, 0x01, 0x04, 0x00};
+_Static_assert(sizeof(sneak) == 152, "sneak does not match its offset table");
+
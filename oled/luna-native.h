@@ -0,0 +1,103 @@
+// Generated by "rle.c", do not edit. Regenerate with:
+// ./rle -m oled/luna-native.manifest -r -c raw,rle,lz -s 32x32 logo=oled/assets/luna-logo.pbm -c raw,rle,delta,lz -s 32x24 -o oled/luna-native.h sit=oled/assets/luna.pbm@0,1 walk=oled/assets/luna.pbm@2,3 run=oled/assets/luna.pbm@4,5 bark=oled/assets/luna.pbm@6,7 sneak=oled/assets/luna.pbm@8,9
+
+#pragma once
+
+static unsigned char const logo[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x20, 0x09, 0x00, 0x6a, 0x00, 0xc6, 0x00,
+    // Frame 0, rle
+    0x01, 0x01, 0xc0, 0x06, 0xe0, 0x02, 0xc0, 0x02, 0x80, 0x05, 0x00, 0x02, 0x08, 0x85, 0x18, 0xf8,
+    0xf0, 0xe0, 0xc0, 0x03, 0x00, 0x88, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00, 0x1f, 0x3f, 0x02, 0x7f,
+    0x09, 0xff, 0x05, 0xfe, 0x03, 0xff, 0x82, 0xbf, 0x1f, 0x03, 0x00, 0x82, 0x2c, 0xb2, 0x03, 0x22,
+    0x04, 0x00, 0x83, 0x1c, 0x3c, 0x78, 0x02, 0xf9, 0x07, 0xfb, 0x06, 0xff, 0x82, 0x3f, 0x0e, 0x03,
+    0x00, 0x85, 0xcb, 0x2c, 0x28, 0x28, 0xc8, 0x09, 0x00, 0x83, 0x09, 0x19, 0x39, 0x02, 0x79, 0x03,
+    0x7d, 0x02, 0x7f, 0x02, 0x3f, 0x82, 0x1f, 0x0f, 0x04, 0x00, 0x86, 0x71, 0x8a, 0x82, 0x8a, 0x71,
+    0x00,
+    // Frame 1, rle
+    0x01, 0x01, 0xc0, 0x06, 0xe0, 0x02, 0xc0, 0x02, 0x80, 0x05, 0x00, 0x02, 0x08, 0x85, 0x18, 0xf8,
+    0xf0, 0xe0, 0xc0, 0x09, 0x00, 0x82, 0x1f, 0x3f, 0x02, 0x7f, 0x09, 0xff, 0x05, 0xfe, 0x03, 0xff,
+    0x8a, 0xbf, 0x1f, 0x00, 0x08, 0x3e, 0x02, 0x0c, 0x9a, 0x28, 0x08, 0x04, 0x00, 0x83, 0x1c, 0x3c,
+    0x78, 0x02, 0xf9, 0x07, 0xfb, 0x06, 0xff, 0x85, 0x3f, 0x0e, 0x00, 0x00, 0xe5, 0x03, 0x25, 0x01,
+    0xe9, 0x0a, 0x00, 0x83, 0x09, 0x19, 0x39, 0x02, 0x79, 0x03, 0x7d, 0x02, 0x7f, 0x02, 0x3f, 0x82,
+    0x1f, 0x0f, 0x03, 0x00, 0x01, 0x03, 0x03, 0x00, 0x01, 0x03, 0x02, 0x00};
+_Static_assert(sizeof(logo) == 198, "logo does not match its offset table");
+
+static unsigned char const sit[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x49, 0x00, 0x5d, 0x00,
+    // Frame 0, rle
+    0x01, 0x01, 0x00, 0x04, 0x80, 0x05, 0x40, 0x05, 0x80, 0x09, 0x00, 0x8b, 0x41, 0xa2, 0x5c, 0x01,
+    0x00, 0x11, 0x00, 0x01, 0x00, 0x07, 0x02, 0x04, 0x00, 0x87, 0x01, 0x07, 0x8d, 0xcd, 0xcd, 0xcb,
+    0xb8, 0x04, 0x00, 0x03, 0x01, 0x03, 0x02, 0x02, 0x04, 0x83, 0x08, 0xd0, 0x20, 0x02, 0x40, 0x03,
+    0x00, 0x84, 0xc0, 0x41, 0x30, 0x0f, 0x0e, 0x00, 0x01, 0x01, 0x04, 0x02, 0x01, 0x01, 0x06, 0x00,
+    // Frame 1, delta
+    0x02, 0x23, 0x00, 0x01, 0x02, 0x17, 0x00, 0x82, 0x40, 0x80, 0x16, 0x00, 0x85, 0x01, 0x03, 0x06,
+    0x06, 0x04, 0x08, 0x00};
+_Static_assert(sizeof(sit) == 93, "sit does not match its offset table");
+
+static unsigned char const walk[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x51, 0x00, 0x98, 0x00,
+    // Frame 0, rle
+    0x01, 0x02, 0x00, 0x8b, 0x40, 0xa0, 0x20, 0x60, 0x20, 0x50, 0x10, 0x50, 0x10, 0xd0, 0xa0, 0x03,
+    0x40, 0x01, 0x80, 0x09, 0x00, 0x8a, 0x10, 0x28, 0x57, 0x40, 0x40, 0x84, 0x80, 0x00, 0x00, 0x01,
+    0x05, 0x00, 0x85, 0x83, 0x8d, 0x4d, 0x4b, 0x38, 0x06, 0x00, 0x85, 0xf0, 0x08, 0x04, 0x7f, 0x80,
+    0x06, 0x00, 0x87, 0x04, 0x0f, 0x0b, 0x9a, 0x9a, 0x96, 0x70, 0x07, 0x00, 0x82, 0x01, 0x02, 0x03,
+    0x04, 0x82, 0x05, 0x03, 0x06, 0x01, 0x06, 0x00,
+    // Frame 1, rle
+    0x01, 0x03, 0x00, 0x8e, 0x40, 0xa0, 0x20, 0x60, 0x20, 0x50, 0x10, 0x50, 0x10, 0xd0, 0xa0, 0x40,
+    0x40, 0x80, 0x0a, 0x00, 0x8a, 0x10, 0x28, 0x57, 0x40, 0x40, 0x84, 0x80, 0x00, 0x00, 0x01, 0x04,
+    0x00, 0x85, 0x81, 0x62, 0x52, 0x69, 0x07, 0x07, 0x00, 0x85, 0xe0, 0x10, 0x08, 0x7f, 0x80, 0x06,
+    0x00, 0x86, 0x0c, 0x13, 0x29, 0x25, 0x43, 0xc0, 0x08, 0x00, 0x82, 0x01, 0x02, 0x03, 0x04, 0x02,
+    0x05, 0x01, 0x03, 0x08, 0x01, 0x02, 0x00};
+_Static_assert(sizeof(walk) == 152, "walk does not match its offset table");
+
+static unsigned char const run[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x57, 0x00, 0x98, 0x00,
+    // Frame 0, rle
+    0x01, 0x02, 0x00, 0x91, 0x40, 0xa0, 0x90, 0x10, 0x08, 0x14, 0x04, 0x14, 0x04, 0xf4, 0x48, 0x30,
+    0xc0, 0x80, 0x40, 0x20, 0xe0, 0x07, 0x00, 0x86, 0x1c, 0x12, 0x19, 0x10, 0x60, 0x81, 0x07, 0x00,
+    0x87, 0x01, 0x02, 0xc7, 0x24, 0x12, 0x09, 0x07, 0x05, 0x00, 0x85, 0x80, 0x40, 0x40, 0x80, 0xff,
+    0x02, 0x00, 0x05, 0x80, 0x84, 0x84, 0x0b, 0x1c, 0xe0, 0x08, 0x00, 0x82, 0x03, 0x04, 0x04, 0x08,
+    0x8b, 0x04, 0x03, 0x00, 0x00, 0x01, 0x02, 0x03, 0x02, 0x04, 0x05, 0x06, 0x04, 0x00,
+    // Frame 1, rle
+    0x01, 0x03, 0x00, 0x8e, 0x80, 0x40, 0x20, 0x10, 0x08, 0x14, 0x04, 0x14, 0x04, 0xf4, 0x48, 0x30,
+    0x40, 0x80, 0x0a, 0x00, 0x86, 0x38, 0x25, 0x33, 0x20, 0xc0, 0x01, 0x08, 0x00, 0x85, 0xc1, 0x47,
+    0x4d, 0x4b, 0x30, 0x09, 0x00, 0x82, 0x01, 0xfe, 0x02, 0x00, 0x05, 0x80, 0x86, 0x41, 0x21, 0x11,
+    0x12, 0x09, 0x07, 0x06, 0x00, 0x01, 0x0e, 0x03, 0x12, 0x85, 0x11, 0x10, 0x08, 0x04, 0x03, 0x0b,
+    0x00};
+_Static_assert(sizeof(run) == 152, "run does not match its offset table");
+
+static unsigned char const bark[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x51, 0x00, 0x79, 0x00,
+    // Frame 0, lz
+    0x03, 0x05, 0x7d, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0xa0, 0x20, 0x00, 0x08, 0xeb, 0x40, 0x80,
+    0x02, 0x60, 0x00, 0x03, 0x00, 0xe2, 0x95, 0xcc, 0xf7, 0x80, 0x00, 0x08, 0x00, 0x40, 0x07, 0x00,
+    0x01, 0x06, 0x7f, 0x0c, 0x09, 0x1c, 0x93, 0x48, 0x24, 0x1c, 0x04, 0xd0, 0xba, 0x00, 0x80, 0xf8,
+    0x04, 0x48, 0x04, 0x87, 0x44, 0x06, 0xb8, 0x1c, 0xff, 0x24, 0x48, 0x48, 0x47, 0x40, 0x20, 0x12,
+    0x0e, 0x0f, 0x02, 0x02, 0x02, 0x01, 0x04, 0xf8,
+    // Frame 1, delta
+    0x02, 0x03, 0x00, 0x8c, 0x80, 0xc0, 0xc0, 0x60, 0xf0, 0x32, 0xf4, 0x30, 0x76, 0x61, 0x48, 0x04,
+    0x0b, 0x00, 0x86, 0x93, 0xdf, 0xea, 0xc0, 0x80, 0x0c, 0x03, 0x00, 0x85, 0x06, 0x00, 0x01, 0x05,
+    0x0a, 0x24, 0x00, 0x82, 0x24, 0x6c, 0x12, 0x00};
+_Static_assert(sizeof(bark) == 121, "bark does not match its offset table");
+
+static unsigned char const sneak[] PROGMEM = {
+    // Version, frames, page width and offsets
+    0x02, 0x02, 0x18, 0x09, 0x00, 0x4c, 0x00, 0x8a, 0x00,
+    // Frame 0, rle
+    0x01, 0x06, 0x00, 0x8d, 0x80, 0x40, 0x20, 0x20, 0x10, 0x28, 0x08, 0x28, 0x08, 0xe8, 0x10, 0x60,
+    0x80, 0x0b, 0x00, 0x86, 0x38, 0x25, 0x33, 0x20, 0xc0, 0x02, 0x06, 0x00, 0x84, 0x01, 0x9a, 0x96,
+    0x70, 0x08, 0x00, 0x85, 0xe0, 0x10, 0x08, 0xfe, 0x01, 0x05, 0x00, 0x86, 0x1c, 0x17, 0x35, 0x34,
+    0x2c, 0xe0, 0x08, 0x00, 0x88, 0x01, 0x02, 0x04, 0x08, 0x09, 0x08, 0x0a, 0x06, 0x04, 0x02, 0x03,
+    0x01, 0x03, 0x00,
+    // Frame 1, delta
+    0x02, 0x05, 0x00, 0x86, 0x80, 0xc0, 0x60, 0x00, 0x30, 0x38, 0x03, 0x20, 0x85, 0xe0, 0xf8, 0x70,
+    0xe0, 0x80, 0x0a, 0x00, 0x87, 0x38, 0x1d, 0x16, 0x13, 0x60, 0x42, 0x02, 0x05, 0x00, 0x85, 0x01,
+    0x02, 0x3e, 0x44, 0x7e, 0x08, 0x00, 0x83, 0x20, 0x30, 0x18, 0x07, 0x00, 0x86, 0x04, 0x31, 0x66,
+    0x7e, 0xaa, 0x60, 0x0f, 0x00, 0x82, 0x0c, 0x04, 0x03, 0x00, 0x04, 0x03, 0x02, 0x00};
+_Static_assert(sizeof(sneak) == 138, "sneak does not match its offset table");
+
@@ -0,0 +1,406 @@
+// Copyright 2021 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Decoders for the animation containers described in "oled-codec.h".
+   Frames are written straight from PROGMEM into the OLED buffer.
+   Bytes that already match the buffer are skipped, as the driver's
+   'oled_write_raw_byte()' would, but without a driver call per byte.
+
+   RLE code is modified from @vectorstorm's Bongocat:
+   (https://github.com/vectorstorm/qmk_firmware/tree/bongo_rle/keyboards/crkbd/keymaps/vectorstorm)
+
+   Usage guide
+   1 Place this file next to keymap.c or in userspace.
+   2 Add the following line into rules.mk:
+        SRC += oled-codec.c
+   3 Include "oled-codec.h" and call 'decode_frame()' with a container
+     generated by "rle.c", the frame index, the OLED buffer index of
+     the frame's first byte and a mirror mask. A mask of 0 draws the
+     frame as encoded, a mask of frame width - 1 reverses its columns.
+   4 Runs and spans of other OLED graphics can be written with the same
+     bulk writers through 'oled_write_run()' and 'oled_write_span_P()'.
+   5 To spread a frame over several passes, call 'decode_begin()' with
+     the same arguments and a 'decoder_t', then 'decode_step()' with a
+     byte budget on every pass until it returns true.
+ */
+
+#include QMK_KEYBOARD_H
+#include "oled-codec.h"
+
+// Driver state, marked once a frame is complete
+extern OLED_BLOCK_TYPE oled_dirty;
+
+// Kinds of the current run in 'decoder_t'
+enum
+{
+    RUN_UNIQUE, // Bytes from the payload
+    RUN_REPEAT, // One byte repeated
+};
+
+// Frames narrower than the display start each page one display width
+// further on, contiguous frames are given the display width and never
+// skip. Writes stop at the end of a page row, only skipped delta runs
+// move into the next one.
+static inline void advance(decode_cursor_t *cursor, uint8_t const n)
+{
+    cursor->index += n;
+    cursor->column += n;
+    if (cursor->column >= cursor->width)
+    {
+        cursor->column -= cursor->width;
+        cursor->index += OLED_DISPLAY_WIDTH - cursor->width;
+    }
+}
+
+static inline uint8_t row_left(decode_cursor_t const *cursor)
+{
+    return cursor->width - cursor->column;
+}
+
+// Bytes from buffer index at to the end of its OLED block, walking in
+// direction step
+static inline uint8_t block_left(uint16_t const at, int8_t const step)
+{
+    return step > 0 ? OLED_BLOCK_SIZE - at % OLED_BLOCK_SIZE : at % OLED_BLOCK_SIZE + 1;
+}
+
+// Bulk writers of n bytes from buffer index at, walking in direction
+// step. Bytes are XOR applied to the buffer under mask and only stored
+// when they differ. Each block is written in one pass and marked dirty
+// once if changed, instead of a driver call and dirty mark per byte.
+static void write_run(uint8_t *buffer, uint32_t *dirty, uint16_t at, int8_t const step, uint8_t const mask,
+                      uint8_t const value, uint16_t n)
+{
+    while (n)
+    {
+        uint8_t count = block_left(at, step);
+        count = count < n ? count : n;
+        n -= count;
+
+        uint8_t changed = 0;
+        uint8_t *out = buffer + at;
+        for (uint8_t i = count; i; --i, out += step)
+        {
+            uint8_t const byte = (*out & mask) ^ value;
+            if (*out != byte)
+            {
+                *out = byte;
+                ++changed;
+            }
+        }
+        if (changed)
+        {
+            *dirty |= (uint32_t)1 << (at / OLED_BLOCK_SIZE);
+        }
+        at += step * count;
+    }
+}
+
+static void write_span_P(uint8_t *buffer, uint32_t *dirty, uint16_t at, int8_t const step, uint8_t const mask,
+                         unsigned char const *data, uint16_t n)
+{
+    while (n)
+    {
+        uint8_t count = block_left(at, step);
+        count = count < n ? count : n;
+        n -= count;
+
+        uint8_t changed = 0;
+        uint8_t *out = buffer + at;
+        for (uint8_t i = count; i; --i, out += step)
+        {
+            uint8_t const byte = (*out & mask) ^ pgm_read_byte(data++);
+            if (*out != byte)
+            {
+                *out = byte;
+                ++changed;
+            }
+        }
+        if (changed)
+        {
+            *dirty |= (uint32_t)1 << (at / OLED_BLOCK_SIZE);
+        }
+        at += step * count;
+    }
+}
+
+// Copy from earlier output, byte by byte so overlapping matches repeat
+static void write_copy(uint8_t *buffer, uint32_t *dirty, uint16_t at, int8_t const step, uint16_t from,
+                       uint16_t n)
+{
+    while (n)
+    {
+        uint8_t count = block_left(at, step);
+        count = count < n ? count : n;
+        n -= count;
+
+        uint8_t changed = 0;
+        uint8_t *out = buffer + at;
+        uint8_t const *in = buffer + from;
+        for (uint8_t i = count; i; --i, out += step, in += step)
+        {
+            if (*out != *in)
+            {
+                *out = *in;
+                ++changed;
+            }
+        }
+        if (changed)
+        {
+            *dirty |= (uint32_t)1 << (at / OLED_BLOCK_SIZE);
+        }
+        at += step * count;
+        from += step * count;
+    }
+}
+
+void oled_write_run(uint16_t const index, uint8_t const value, uint16_t const length)
+{
+    uint32_t dirty = 0;
+    write_run(oled_read_raw(0).current_element, &dirty, index, 1, 0x00, value, length);
+    oled_dirty |= dirty;
+}
+
+void oled_write_span_P(uint16_t const index, unsigned char const *data, uint16_t const length)
+{
+    uint32_t dirty = 0;
+    write_span_P(oled_read_raw(0).current_element, &dirty, index, 1, 0x00, data, length);
+    oled_dirty |= dirty;
+}
+
+static uint16_t read_word(unsigned char const *address)
+{
+    return pgm_read_byte(address) | pgm_read_byte(address + 1) << 8;
+}
+
+// A mirror mask reverses the columns of each page row, so the row is
+// written backwards from its mirrored index
+static inline int8_t mirror_step(decoder_t const *d)
+{
+    return d->mirror ? -1 : 1;
+}
+
+// RLE decoding loop that reads count from the payload
+// If count >= 0x80, next (count - 128) bytes are unique
+// If count < 0x80, next byte is repeated by count
+// Decoded bytes are XOR applied to the OLED buffer when mask is 0xff,
+// and zero runs of a delta are skipped without touching the buffer.
+// Returns the budget left.
+static uint16_t step_rle(decoder_t *d, uint8_t *buffer, uint8_t const mask, uint16_t budget)
+{
+    decode_cursor_t cursor = d->cursor;
+    unsigned char const *data = d->data;
+    int8_t const step = mirror_step(d);
+
+    while (budget)
+    {
+        if (!d->run)
+        {
+            if (data == d->end)
+            {
+                break;
+            }
+            uint8_t const count = pgm_read_byte(data++);
+            if (count & 0x80)
+            {
+                // Next count-128 bytes are unique
+                d->run = count & ~(0x80);
+                d->step = RUN_UNIQUE;
+                continue;
+            }
+            // Next byte is repeated by count
+            d->run = count;
+            d->byte = pgm_read_byte(data++);
+            d->step = RUN_REPEAT;
+            if (mask && !d->byte && cursor.width == OLED_DISPLAY_WIDTH)
+            {
+                advance(&cursor, count);
+                d->run = 0;
+                --budget;
+            }
+            continue;
+        }
+
+        uint8_t n = row_left(&cursor);
+        n = d->run < n ? d->run : n;
+        n = budget < n ? budget : n;
+        d->run -= n;
+        budget -= n;
+        if (d->step == RUN_UNIQUE)
+        {
+            write_span_P(buffer, &d->dirty, cursor.index ^ d->mirror, step, mask, data, n);
+            data += n;
+        }
+        else if (!mask || d->byte)
+        {
+            write_run(buffer, &d->dirty, cursor.index ^ d->mirror, step, mask, d->byte, n);
+        }
+        advance(&cursor, n);
+    }
+
+    d->cursor = cursor;
+    d->data = data;
+    return budget;
+}
+
+static uint16_t step_raw(decoder_t *d, uint8_t *buffer, uint16_t budget)
+{
+    decode_cursor_t cursor = d->cursor;
+    int8_t const step = mirror_step(d);
+
+    while (budget && d->data != d->end)
+    {
+        uint16_t n = row_left(&cursor);
+        n = budget < n ? budget : n;
+        n = d->end - d->data < n ? d->end - d->data : n;
+        write_span_P(buffer, &d->dirty, cursor.index ^ d->mirror, step, 0x00, d->data, n);
+        d->data += n;
+        budget -= n;
+        advance(&cursor, n);
+    }
+
+    d->cursor = cursor;
+    return budget;
+}
+
+// LZSS decoding loop, flag bits select a literal byte when set or a
+// match of earlier output when clear. Matches are copied from bytes
+// already in the OLED buffer so no window is kept in RAM.
+static uint16_t step_lz(decoder_t *d, uint8_t *buffer, uint16_t budget)
+{
+    decode_cursor_t cursor = d->cursor;
+    decode_cursor_t from = d->from;
+    unsigned char const *data = d->data;
+    int8_t const step = mirror_step(d);
+
+    while (budget)
+    {
+        if (d->run)
+        {
+            // Source and output rows of a strided frame end apart
+            uint8_t n = row_left(&cursor);
+            n = row_left(&from) < n ? row_left(&from) : n;
+            n = d->run < n ? d->run : n;
+            n = budget < n ? budget : n;
+            d->run -= n;
+            budget -= n;
+            write_copy(buffer, &d->dirty, cursor.index ^ d->mirror, step, from.index ^ d->mirror, n);
+            advance(&from, n);
+            advance(&cursor, n);
+            continue;
+        }
+        if (data == d->end)
+        {
+            break;
+        }
+
+        if (!d->items)
+        {
+            d->flags = pgm_read_byte(data++);
+            d->items = 8;
+        }
+        if (d->flags & 1)
+        {
+            write_span_P(buffer, &d->dirty, cursor.index ^ d->mirror, step, 0x00, data++, 1);
+            advance(&cursor, 1);
+            ++d->decoded;
+            --budget;
+        }
+        else
+        {
+            uint16_t const match = read_word(data);
+            uint16_t const back = (match >> d->length_bits) + 1;
+            data += 2;
+            d->run = (match & ((1 << d->length_bits) - 1)) + OLED_LZ_MIN_MATCH;
+
+            // Locate the match source once, then walk it like the cursor
+            uint16_t const offset = d->decoded - back;
+            from.width = cursor.width;
+            from.column = offset % cursor.width;
+            from.index = d->start + offset / cursor.width * OLED_DISPLAY_WIDTH + from.column;
+            d->decoded += d->run;
+        }
+        d->flags >>= 1;
+        --d->items;
+    }
+
+    d->cursor = cursor;
+    d->from = from;
+    d->data = data;
+    return budget;
+}
+
+void decode_begin(decoder_t *decoder, unsigned char const *anim, uint8_t const index, uint16_t const start,
+                  uint8_t const mirror)
+{
+    memset(decoder, 0, sizeof(*decoder));
+    if (pgm_read_byte(anim) != OLED_ANIM_VERSION)
+    {
+        return;
+    }
+
+    uint8_t width = pgm_read_byte(anim + 2);
+    if (!width)
+    {
+        width = OLED_DISPLAY_WIDTH;
+    }
+    unsigned char const *offset = anim + OLED_ANIM_HEADER + index * 2;
+    uint16_t const frame = read_word(offset);
+
+    decoder->codec = pgm_read_byte(anim + frame);
+    decoder->data = anim + frame + 1;
+    decoder->end = anim + read_word(offset + 2);
+    decoder->cursor = (decode_cursor_t){start, 0, width};
+    decoder->start = start;
+    decoder->mirror = mirror;
+    if (decoder->codec == OLED_CODEC_LZ)
+    {
+        decoder->length_bits = 16 - pgm_read_byte(decoder->data++);
+    }
+}
+
+bool decode_step(decoder_t *decoder, uint16_t budget)
+{
+    uint8_t *buffer = oled_read_raw(0).current_element;
+
+    switch (decoder->codec)
+    {
+    case OLED_CODEC_RAW:
+        budget = step_raw(decoder, buffer, budget);
+        break;
+    case OLED_CODEC_RLE:
+        budget = step_rle(decoder, buffer, 0x00, budget);
+        break;
+    case OLED_CODEC_DELTA:
+        budget = step_rle(decoder, buffer, 0xff, budget);
+        break;
+    case OLED_CODEC_LZ:
+        budget = step_lz(decoder, buffer, budget);
+        break;
+    }
+
+    // Runs end with their budget, so an unspent budget means the payload ran out
+    if (!budget && (decoder->run || decoder->data != decoder->end))
+    {
+        return false;
+    }
+    // The driver sends whole dirty blocks to the panel
+    decoder->flushed = 0;
+    for (uint32_t dirty = decoder->dirty; dirty; dirty &= dirty - 1)
+    {
+        decoder->flushed += OLED_BLOCK_SIZE;
+    }
+    oled_dirty |= decoder->dirty;
+    decoder->dirty = 0;
+    return true;
+}
+
+uint16_t decode_frame(unsigned char const *anim, uint8_t const index, uint16_t const start, uint8_t const mirror)
+{
+    decoder_t decoder;
+    decode_begin(&decoder, anim, index, start, mirror);
+    while (!decode_step(&decoder, UINT16_MAX))
+    {
+    }
+    return decoder.flushed;
+}
@@ -0,0 +1,105 @@
+// Copyright 2022 @ethanharstad
+// SPDX-License-Identifier: GPL-2.0+
+
+/* OLED animation container shared by the "rle.c" encoder and the
+   frame decoders. All multi-byte fields are little-endian.
+
+   Container
+     [0]     OLED_ANIM_VERSION
+     [1]     Frame count N
+     [2]     Page width. 0 for frames stored as one contiguous span of
+             the OLED buffer, otherwise frames are this many columns
+             wide and each page starts OLED_DISPLAY_WIDTH bytes after
+             the last, as with frames pre-rotated for the native panel.
+     [3..]   N+1 16-bit offsets from the container start. Frame i
+             spans offset[i] to offset[i+1], offset[N] is the total
+             container length.
+   Frame
+     [0]     Codec ID
+     [1..]   Codec payload, length implied by the offset table
+
+   Codecs
+     OLED_CODEC_RAW    Uncompressed bytes
+     OLED_CODEC_RLE    If count >= 0x80, next (count - 128) bytes are
+                       unique. If count < 0x80, next byte is repeated
+                       by count.
+     OLED_CODEC_DELTA  OLED_CODEC_RLE stream XOR applied to the previous
+                       frame of the container. Frame 0 is never a delta.
+     OLED_CODEC_LZ     Window bits W, then LZSS items. A flag byte covers
+                       the next 8 items, least significant bit first. Set
+                       bits are literal bytes, clear bits are 16-bit
+                       matches copying (match & (2^(16-W) - 1)) +
+                       OLED_LZ_MIN_MATCH bytes from (match >> (16-W)) + 1
+                       bytes back in the decoded frame.
+
+   Frames pre-rotated by "rle.c -r" are laid out as the driver would
+   send a 90 or 270 degree rotated buffer to the panel. They are drawn
+   with the display in OLED_ROTATION_0 or OLED_ROTATION_180, which the
+   panel applies in hardware, so flushes skip the software transpose.
+ */
+
+#pragma once
+
+#define OLED_ANIM_VERSION 2
+#define OLED_ANIM_HEADER 3
+
+#define OLED_CODEC_RAW 0
+#define OLED_CODEC_RLE 1
+#define OLED_CODEC_DELTA 2
+#define OLED_CODEC_LZ 3
+
+#define OLED_LZ_MIN_MATCH 3
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// OLED buffer index and column within the page row of a frame
+typedef struct
+{
+    uint16_t index;
+    uint8_t column;
+    uint8_t width;
+} decode_cursor_t;
+
+// Resumable frame decode, see 'decode_begin()'
+typedef struct
+{
+    unsigned char const *data; // Next payload byte
+    unsigned char const *end;
+    decode_cursor_t cursor;    // Next output byte
+    decode_cursor_t from;      // LZ match source
+    uint16_t start;
+    uint16_t decoded;          // LZ output bytes so far
+    uint16_t run;              // Bytes left of the current run or match
+    uint32_t dirty;            // OLED blocks written but not yet marked
+    uint16_t flushed;          // Panel bytes of those blocks, once complete
+    uint8_t codec;
+    uint8_t mirror;
+    uint8_t step;              // Kind of the current run
+    uint8_t byte;              // RLE repeated byte
+    uint8_t flags;             // LZ flag bits and items left under them
+    uint8_t items;
+    uint8_t length_bits;
+} decoder_t;
+
+// Bulk writes of length bytes into the OLED buffer from index, either
+// one repeated value or a PROGMEM span. Bytes are only stored when they
+// differ and each changed block is marked dirty once.
+void oled_write_run(uint16_t const index, uint8_t const value, uint16_t const length);
+void oled_write_span_P(uint16_t const index, unsigned char const *data, uint16_t const length);
+
+// Decode frame index of a container into the OLED buffer from index
+// start. Buffer indexes are XOR'd with mirror, so a mask of the frame
+// width - 1 on a power of two wide frame reverses its columns.
+// Returns the bytes the driver will send for the blocks it changed.
+uint16_t decode_frame(unsigned char const *anim, uint8_t const index, uint16_t const start, uint8_t const mirror);
+
+// Time-sliced 'decode_frame()'. Begin a frame, then call 'decode_step()'
+// once per pass to decode at most budget output bytes. Bytes go straight
+// into the OLED buffer, but their blocks are only marked dirty when the
+// frame is complete, so the driver never flushes a partial frame.
+// Returns true once the frame is complete, with its panel bytes in
+// 'decoder->flushed'.
+void decode_begin(decoder_t *decoder, unsigned char const *anim, uint8_t const index, uint16_t const start,
+                  uint8_t const mirror);
+bool decode_step(decoder_t *decoder, uint16_t budget);
@@ -16,58 +16,112 @@
         render_mod_status();
    4 Add the font file reference into `config.h`:
         #define OLED_FONT_H "oledfont.c"
-   5 Add your layer numbers for NUM, SYM, and FNC. Example:
-        #define NUM 1
-        #define SYM 2
-        #define FNC 3
+     Or, for a font of only the glyphs written by the userspace, run
+     "fontsubset.c" after changing any string, review it for build
+     instructions, and use its output instead:
+        #define OLED_FONT_H "oled/oledfont-subset.c"
+        #define OLED_FONT_SUBSET
+        #define OLED_FONT_END 0
+     with OLED_FONT_END the last subset glyph, as "fontsubset.c" reports.
+     Strings are then written with 'oled_write_glyphs_P()', which maps
+     character codes to the subset glyphs:
+        extern void oled_write_glyphs_P(char const *data, bool const invert);
+     Static text is best drawn by "fontsubset.c -t" into raw bitmaps,
+     as it is in "oled-text.h", and written with one 'oled_write_raw_P()'
+     instead of a font lookup per glyph every render. Its glyphs then
+     leave the subset font. Bitmaps are drawn for the 32 pixel lines of
+     OLED_ROTATION_270, add the following line into config.h to use them:
+        #define OLED_TEXT_RAW
+   5 The layer icons are left out by default. To draw them, add the
+     following line into config.h:
+        #define OLED_LAYER_ICONS
+     They need NUM, SYM and FNC layer numbers, LAYER_COUNT and
+     LAYER_HIGHEST_TABLE, as generated by "keymap/sparse.c -c" from
+     the keymap export and included from config.h:
+        #include "keymap/ethanharstad-layer-ids.h"
 */
 
 #include QMK_KEYBOARD_H
 
+#ifdef OLED_FONT_SUBSET
+#include "oledfont-map.h"
+#if defined(OLED_FONT_MAP_TEXT_RAW) && !defined(OLED_TEXT_RAW)
+#error "The subset font leaves out the glyphs of raw text, define OLED_TEXT_RAW"
+#endif
+#endif
+#ifdef OLED_TEXT_RAW
+#include "oled-text.h"
+#endif
+
+// 'oled_write_P()' of a string of characters from the full font
+void oled_write_glyphs_P(char const *data, bool const invert)
+{
+#ifdef OLED_FONT_SUBSET
+    for (uint8_t c = pgm_read_byte(data); c; c = pgm_read_byte(++data))
+    {
+        uint8_t const glyph =
+            c >= OLED_FONT_MAP_FIRST && c <= OLED_FONT_MAP_LAST ? pgm_read_byte(&font_map[c - OLED_FONT_MAP_FIRST]) : 0;
+        oled_write_char(glyph, invert);
+    }
+#else
+    oled_write_P(data, invert);
+#endif
+}
+
 static void render_logo(void)
 {
+#ifdef OLED_TEXT_RAW
+    static char const qmk_logo_raw[] PROGMEM = QMK_LOGO_RAW;
+
+    oled_write_raw_P(qmk_logo_raw, sizeof(qmk_logo_raw));
+#else
     static const char PROGMEM qmk_logo[] = {
         0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94,
         0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC, 0xAD, 0xAE, 0xAF, 0xB0, 0xB1, 0xB2, 0xB3, 0xB4,
         0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0, 0xD1, 0xD2, 0xD3, 0xD4, 0x00};
 
-    oled_write_P(qmk_logo, false);
+    oled_write_glyphs_P(qmk_logo, false);
+#endif
 }
 
-// static void render_layer_state(uint8_t const state)
-// {
-//     static char const base_layer[] PROGMEM = {
-//         0x20, 0x9a, 0x9b, 0x9c, 0x20,
-//         0x20, 0xba, 0xbb, 0xbc, 0x20,
-//         0x20, 0xda, 0xdb, 0xdc, 0x20, 0};
-//     static char const numb_layer[] PROGMEM = {
-//         0x20, 0x94, 0x95, 0x96, 0x20,
-//         0x20, 0xb4, 0xb5, 0xb6, 0x20,
-//         0x20, 0xd4, 0xd5, 0xd6, 0x20, 0};
-//     static char const symb_layer[] PROGMEM = {
-//         0x20, 0x97, 0x98, 0x99, 0x20,
-//         0x20, 0xb7, 0xb8, 0xb9, 0x20,
-//         0x20, 0xd7, 0xd8, 0xd9, 0x20, 0};
-//     static char const func_layer[] PROGMEM = {
-//         0x20, 0x9d, 0x9e, 0x9f, 0x20,
-//         0x20, 0xbd, 0xbe, 0xbf, 0x20,
-//         0x20, 0xdd, 0xde, 0xdf, 0x20, 0};
-
-//     switch (state)
-//     {
-//     case FNC:
-//         oled_write_P(func_layer, false);
-//         break;
-//     case SYM:
-//         oled_write_P(symb_layer, false);
-//         break;
-//     case NUM:
-//         oled_write_P(numb_layer, false);
-//         break;
-//     default:
-//         oled_write_P(base_layer, false);
-//     }
-// }
+#ifdef OLED_LAYER_ICONS
+#define LAYER_ICON_SIZE 16
+
+// Icon glyphs of every layer, the base icon for unnamed layers
+#ifdef OLED_TEXT_RAW
+static char const layer_icons_raw[][LAYER_ICONS_RAW_SIZE] PROGMEM = LAYER_ICONS_RAW;
+#else
+static char const layer_icons[][LAYER_ICON_SIZE] PROGMEM = {
+    {0x20, 0x9a, 0x9b, 0x9c, 0x20,
+     0x20, 0xba, 0xbb, 0xbc, 0x20,
+     0x20, 0xda, 0xdb, 0xdc, 0x20, 0},
+    {0x20, 0x94, 0x95, 0x96, 0x20,
+     0x20, 0xb4, 0xb5, 0xb6, 0x20,
+     0x20, 0xd4, 0xd5, 0xd6, 0x20, 0},
+    {0x20, 0x97, 0x98, 0x99, 0x20,
+     0x20, 0xb7, 0xb8, 0xb9, 0x20,
+     0x20, 0xd7, 0xd8, 0xd9, 0x20, 0},
+    {0x20, 0x9d, 0x9e, 0x9f, 0x20,
+     0x20, 0xbd, 0xbe, 0xbf, 0x20,
+     0x20, 0xdd, 0xde, 0xdf, 0x20, 0},
+};
+#endif
+
+// Highest layer of every layer state and the icon of every layer, so
+// rendering is two table reads instead of 'get_highest_layer()'
+static uint8_t const layer_highest[1 << LAYER_COUNT] PROGMEM = LAYER_HIGHEST_TABLE;
+static uint8_t const layer_icon[LAYER_COUNT] PROGMEM = {[NUM] = 1, [SYM] = 2, [FNC] = 3};
+
+static void render_layer_state(layer_state_t const state)
+{
+    uint8_t const highest = pgm_read_byte(&layer_highest[state & LAYER_STATE_MASK]);
+#ifdef OLED_TEXT_RAW
+    oled_write_raw_P(layer_icons_raw[pgm_read_byte(&layer_icon[highest])], LAYER_ICONS_RAW_SIZE);
+#else
+    oled_write_glyphs_P(layer_icons[pgm_read_byte(&layer_icon[highest])], false);
+#endif
+}
+#endif
 
 // static void render_gui_alt(uint8_t const gui, uint8_t const alt)
 // {
@@ -204,8 +258,10 @@ void render_mod_status(void)
 #endif
 
     render_logo();
-    // oled_set_cursor(0, 6);
-    // render_layer_state(get_highest_layer(layer_state | default_layer_state));
+#ifdef OLED_LAYER_ICONS
+    oled_set_cursor(0, 6);
+    render_layer_state(layer_state | default_layer_state);
+#endif
 
     // oled_set_cursor(0, 11);
     // render_gui_alt(mods & MOD_MASK_GUI, mods & MOD_MASK_ALT);
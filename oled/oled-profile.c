@@ -0,0 +1,161 @@
+// Copyright 2022 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Render cost instrumentation for 'oled_task_user()' in "oled-sprite.c".
+   Matrix scans are counted from 'housekeeping_task_user()', which runs
+   once per main loop, as 'oled_task_user()' only runs every
+   OLED_UPDATE_INTERVAL on split boards. Time between scans includes
+   the OLED flush that follows each render, so the worst gap is the
+   input latency the OLED adds.
+
+   Usage guide
+   1 Add the following lines into rules.mk:
+        SRC += oled-profile.c
+        OPT_DEFS += -DOLED_PROFILE
+   2 Include "oled-profile.h" and count scans in keymap.c:
+        void housekeeping_task_user(void) {
+            oled_profile_scan();
+        }
+   3 With 'CONSOLE_ENABLE = yes' the scan rate, worst gap and render
+     times are printed to 'qmk console' every second. Sprite renders
+     are timed per state, with states from OLED_PROFILE_STATES on
+     together, and the status render of the secondary half apart.
+     Host builds can read them from:
+        extern oled_profile_t oled_profile;
+   4 On AVR the clock reads Timer0, which QMK runs at one compare match
+     per millisecond, for microseconds at its tick. Elsewhere it defaults
+     to 'timer_read32()' and times are printed as milliseconds. Define
+     OLED_PROFILE_US() in config.h for a finer microsecond clock, such
+     as a cycle counter divided by the CPU clock in MHz.
+ */
+
+#ifdef OLED_PROFILE
+
+#include QMK_KEYBOARD_H
+#include "oled-profile.h"
+
+#if defined(OLED_PROFILE_US)
+#define PROFILE_UNIT "us"
+#define PROFILE_SCALE 1
+#elif defined(__AVR__)
+#include <util/atomic.h>
+
+// Milliseconds of the QMK timer and the Timer0 count since its last
+// compare match. A match not yet serviced has restarted the count.
+static uint32_t profile_us(void)
+{
+    uint32_t ms;
+    uint8_t ticks;
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+    {
+        ms = timer_read32();
+        ticks = TCNT0;
+        if ((TIFR0 & _BV(OCF0A)) && ticks < OCR0A / 2)
+        {
+            ++ms;
+        }
+    }
+    return ms * 1000 + (uint32_t)ticks * 1000 / (OCR0A + 1);
+}
+#define OLED_PROFILE_US() profile_us()
+#define PROFILE_UNIT "us"
+#define PROFILE_SCALE 1
+#else
+#define OLED_PROFILE_US() (timer_read32() * 1000)
+#define PROFILE_UNIT "ms"
+#define PROFILE_SCALE 1000
+#endif
+
+// Microseconds in the printed unit
+#define PROFILE_PRINT(us) ((unsigned long)((us) / PROFILE_SCALE))
+
+oled_profile_t oled_profile = {0};
+
+#ifdef CONSOLE_ENABLE
+static void print_timing(char const *name, oled_timing_t const *timing)
+{
+    if (timing->count)
+    {
+        uprintf("oled: %s renders %lu, min/avg/max %lu/%lu/%lu" PROFILE_UNIT "\n", name,
+                (unsigned long)timing->count, PROFILE_PRINT(timing->min),
+                PROFILE_PRINT(timing->total / timing->count), PROFILE_PRINT(timing->max));
+    }
+}
+#endif
+
+static void print_profile(void)
+{
+#ifdef CONSOLE_ENABLE
+    uprintf("oled: %u scans/s, worst gap %lu" PROFILE_UNIT "\n", oled_profile.scan_rate,
+            PROFILE_PRINT(oled_profile.worst_gap));
+    // OLED_PROFILE_STATES is below 10 for the single digit
+    char name[] = "state 0";
+    for (uint8_t state = 0; state < OLED_PROFILE_STATES; ++state)
+    {
+        name[sizeof(name) - 2] = '0' + state;
+        print_timing(name, &oled_profile.renders[state]);
+    }
+    print_timing("later states", &oled_profile.other_states);
+    print_timing("status", &oled_profile.status);
+#endif
+}
+
+void oled_profile_scan(void)
+{
+    static uint32_t window = 0;
+    static uint32_t last = 0;
+    static uint32_t worst = 0;
+    static uint16_t scans = 0;
+    uint32_t const now = OLED_PROFILE_US();
+
+    if (last && now - last > worst)
+    {
+        worst = now - last;
+    }
+    last = now;
+    ++scans;
+
+    // Publish and restart the scan window every second
+    if (timer_elapsed32(window) >= 1000)
+    {
+        window = timer_read32();
+        oled_profile.scan_rate = scans;
+        oled_profile.worst_gap = worst;
+        scans = 0;
+        worst = 0;
+        print_profile();
+    }
+}
+
+uint32_t oled_profile_start(void)
+{
+    return OLED_PROFILE_US();
+}
+
+static void record_render(oled_timing_t *timing, uint32_t const start)
+{
+    uint32_t const elapsed = OLED_PROFILE_US() - start;
+
+    if (!timing->count || elapsed < timing->min)
+    {
+        timing->min = elapsed;
+    }
+    if (elapsed > timing->max)
+    {
+        timing->max = elapsed;
+    }
+    timing->total += elapsed;
+    ++timing->count;
+}
+
+void oled_profile_render(uint8_t const state, uint32_t const start)
+{
+    record_render(state < OLED_PROFILE_STATES ? &oled_profile.renders[state] : &oled_profile.other_states, start);
+}
+
+void oled_profile_status(uint32_t const start)
+{
+    record_render(&oled_profile.status, start);
+}
+
+#endif
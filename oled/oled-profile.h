@@ -0,0 +1,48 @@
+// Copyright 2022 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Render cost and scan rate instrumentation, see "oled-profile.c".
+   Without OLED_PROFILE the calls compile to nothing.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define OLED_PROFILE_STATES 8
+
+// Render times in microseconds
+typedef struct
+{
+    uint32_t count;
+    uint32_t total;
+    uint32_t min;
+    uint32_t max;
+} oled_timing_t;
+
+typedef struct
+{
+    oled_timing_t renders[OLED_PROFILE_STATES]; // Per sprite state
+    oled_timing_t other_states;                  // Sprite states from OLED_PROFILE_STATES on
+    oled_timing_t status;                        // Status render of the secondary half
+    uint16_t scan_rate;                          // Scans in the last full second
+    uint32_t worst_gap;                          // Longest microseconds between them
+} oled_profile_t;
+
+#ifdef OLED_PROFILE
+extern oled_profile_t oled_profile;
+
+// Count a matrix scan, from 'housekeeping_task_user()'
+void oled_profile_scan(void);
+// Time stamp to time a render from
+uint32_t oled_profile_start(void);
+// Record the time since start of a sprite render in state, or of the
+// secondary status render
+void oled_profile_render(uint8_t const state, uint32_t const start);
+void oled_profile_status(uint32_t const start);
+#else
+#define oled_profile_scan() ((void)0)
+#define oled_profile_start() 0
+#define oled_profile_render(state, start) ((void)(start))
+#define oled_profile_status(start) ((void)(start))
+#endif
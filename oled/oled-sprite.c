@@ -0,0 +1,386 @@
+// Copyright 2022 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Sprite animation engine for the primary OLED, driven by key press
+   timer and the typing speed estimator of "oled-typing.c". Pets such
+   as "oled-bongocat.c" and "oled-luna.c" only describe their states in
+   "oled-sprite.h" tables, and this file owns the timers, state
+   selection, frame playback and OLED callbacks.
+
+   Usage guide
+   1 Place this file next to keymap.c or in userspace.
+   2 Add the following lines into rules.mk with one pet module:
+        OLED_ENABLE = yes
+        SRC += oled-sprite.c oled-codec.c oled-typing.c oled-bongocat.c
+   3 Include "oled-sprite.h" and "oled-typing.h" and add the following
+     'process_record_user()' code block into keymap.c to trigger
+     animation tap timer and typing speed with key presses:
+        bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+            if (record->event.pressed) {
+                oled_tap_timer = timer_read32();
+                typing_record(oled_tap_timer);
+                oled_invalidate(OLED_INVALID_TAP);
+            }
+            return true;
+        }
+   4 The 'oled_task_user()' calls 'render_mod_status()' from "oled-icons.c"
+     for secondary OLED. Review that file for usage guide or replace
+     'render_mod_status()' with your own function.
+   5 Either OLED only renders after a tracked input changed: layer, LED
+     state, modifiers, key tap or the animation tick. Call the following
+     from 'layer_state_set_user()', 'led_update_user()' and the
+     'process_record_user()' block above, with the matching input:
+        oled_invalidate(OLED_INVALID_LAYER);
+     Rendered and skipped passes are counted in:
+        extern uint32_t oled_renders;
+        extern uint32_t oled_skipped_renders;
+   6 Render times per state and the scan rate can be measured with
+     "oled-profile.c", review that file for usage guide.
+   7 To animate the sprite on both halves, sync the status with
+     "oled-sync.c" and add the following into config.h:
+        #define OLED_SPRITE_SECONDARY
+     The secondary half runs its own engine from the synced tap time
+     and modifiers, and frames follow the synced timer on both halves.
+   8 To bound the time of a pass, add the following into config.h with
+     the most bytes a pass may decode:
+        #define OLED_DECODE_BUDGET 64
+     Larger frames are decoded over several passes and only flushed
+     once complete. Passes run every OLED_UPDATE_INTERVAL, 50 ms on
+     split boards, so a frame of n bytes takes n / budget passes of that
+     interval to show. Keep it within the frame duration or animations
+     slow down, a 512 byte frame at 200 ms needs a budget of at least
+     512 / (200 / 50) = 128 bytes. "host/bench.c" counts the frames
+     shown at this pacing.
+ */
+
+#include QMK_KEYBOARD_H
+#include "oled-codec.h"
+#include "oled-profile.h"
+#include "oled-sprite.h"
+#include "oled-sync.h"
+#include "oled-typing.h"
+
+uint32_t oled_tap_timer = 0;
+uint32_t oled_renders = 0;
+uint32_t oled_skipped_renders = 0;
+uint16_t oled_frame_bytes = 0;
+
+// The secondary half animates its own sprite from the synced status
+#ifdef OLED_SPRITE_SECONDARY
+#define SPRITE_SECONDARY true
+#else
+#define SPRITE_SECONDARY false
+#endif
+
+// Every input is invalid until the first render
+static uint8_t oled_invalid = 0xff;
+
+void oled_invalidate(uint8_t const inputs)
+{
+    oled_invalid |= inputs;
+}
+
+// Host LED state is only known to the primary half, the secondary
+// reads caps lock from the synced status
+static bool caps_lock_on(void)
+{
+    return is_keyboard_master() ? host_keyboard_led_state().caps_lock : oled_status.caps_lock;
+}
+
+static bool state_entered(sprite_state_t const *state, uint8_t const mods, typing_bucket_t const typing)
+{
+    return (state->flags & SPRITE_ALWAYS) || (state->mods & mods) ||
+           ((state->flags & SPRITE_CAPS) && caps_lock_on()) ||
+           ((state->flags & SPRITE_TYPING) && typing == TYPING_ACTIVE) ||
+           ((state->flags & SPRITE_SLOWING) && typing != TYPING_IDLE) ||
+           timer_elapsed32(oled_tap_timer) < state->interval;
+}
+
+// State on screen
+static uint8_t shown = UINT8_MAX;
+
+#ifdef OLED_DECODE_BUDGET
+// Frame decoded over several passes, see 'decode_step()'. Every pass
+// waits OLED_UPDATE_INTERVAL, so the passes of a frame must fit within
+// its duration.
+static decoder_t decoder;
+static bool decoding = false;
+
+static void step_frame(uint16_t const budget)
+{
+    decoding = !decode_step(&decoder, budget);
+    if (!decoding)
+    {
+        oled_frame_bytes = decoder.flushed;
+    }
+}
+
+static void show_frame(unsigned char const *frames, uint8_t const index, uint8_t const mirror)
+{
+    // Blocks written by an abandoned frame are still to be flushed
+    uint32_t const dirty = decoding ? decoder.dirty : 0;
+    decode_begin(&decoder, frames, index, oled_sprite.start, mirror);
+    decoder.dirty = dirty;
+    step_frame(OLED_DECODE_BUDGET);
+}
+#else
+static bool const decoding = false;
+
+static void show_frame(unsigned char const *frames, uint8_t const index, uint8_t const mirror)
+{
+    oled_frame_bytes = decode_frame(frames, index, oled_sprite.start, mirror);
+}
+#endif
+
+// Show the first state entered, decoding its keyframe on entry. On an
+// animation tick the state advances with deltas and wraps around to
+// its keyframe. With OLED_SPRITE_SECONDARY the frame is instead the
+// one due on the synced timer, so both halves show the same frame and
+// a half that entered late or missed a tick catches up with deltas.
+// A frame left unfinished by OLED_DECODE_BUDGET is continued first, and
+// a tick that comes due meanwhile waits for it in 'render_sprite()'.
+// Returns the frame duration of the state.
+static uint16_t animate_sprite(bool const tick)
+{
+    static uint8_t index = 0;
+    sprite_state_t state;
+    typing_bucket_t const typing = typing_bucket(timer_read32());
+    uint8_t mods = get_mods();
+#ifndef NO_ACTION_ONESHOT
+    mods |= get_oneshot_mods();
+#endif
+
+    uint8_t current = 0;
+    for (;; ++current)
+    {
+        memcpy_P(&state, &oled_sprite.states[current], sizeof(state));
+        if (current == oled_sprite.count - 1 || state_entered(&state, mods, typing))
+        {
+            break;
+        }
+    }
+
+    if (oled_sprite.render)
+    {
+        oled_sprite.render();
+    }
+
+#ifdef OLED_DECODE_BUDGET
+    if (decoding && current == shown)
+    {
+        step_frame(OLED_DECODE_BUDGET);
+        return state.duration;
+    }
+#endif
+
+    uint8_t const mirror = is_keyboard_left() ? oled_sprite.mirror_left : 0;
+#ifdef OLED_SPRITE_SECONDARY
+    (void)tick;
+    uint8_t const due = sync_timer_read32() / state.duration % pgm_read_byte(state.frames + 1);
+    if (current != shown || due < index)
+    {
+        shown = current;
+        index = 0;
+        show_frame(state.frames, 0, mirror);
+    }
+    while (index < due && !decoding)
+    {
+        show_frame(state.frames, ++index, mirror);
+    }
+#else
+    if (current != shown || (tick && index >= pgm_read_byte(state.frames + 1) - 1))
+    {
+        shown = current;
+        index = 0;
+        show_frame(state.frames, 0, mirror);
+    }
+    else if (tick)
+    {
+        show_frame(state.frames, ++index, mirror);
+    }
+#endif
+    return state.duration;
+}
+
+// Timer and duration of the frame on screen. Both halves tick on the
+// same frame boundaries of the synced timer with OLED_SPRITE_SECONDARY.
+static uint16_t duration = 0;
+#ifdef OLED_SPRITE_SECONDARY
+static uint32_t anim_timer = 0;
+#define anim_timer_due() (sync_timer_elapsed32(anim_timer) >= duration)
+
+// Frame boundary of one synced timer read
+static uint32_t anim_timer_read(void)
+{
+    uint32_t const now = sync_timer_read32();
+    return now - now % duration;
+}
+#else
+static uint16_t anim_timer = 0;
+#define anim_timer_read() timer_read()
+#define anim_timer_due() (timer_elapsed(anim_timer) >= duration)
+#endif
+
+// Frame boundary of a tick whose frame is still decoding, so passes of
+// OLED_DECODE_BUDGET count toward the frame duration instead of adding
+// to it
+static uint32_t tick_timer = 0;
+static bool ticking = false;
+// The next frame came due before the last one was complete
+static bool late = false;
+
+// Invalidate the sprite when its next frame is due, or typing activity
+// changed bucket as time passed since the last key. Once timed out,
+// only the pass that turns the display off renders.
+static void tick_sprite(void)
+{
+    static bool timed_out = false;
+    if (timer_elapsed32(oled_tap_timer) > OLED_TIMEOUT)
+    {
+        if (!timed_out)
+        {
+            timed_out = true;
+            oled_invalid |= OLED_INVALID_TICK;
+        }
+        return;
+    }
+    timed_out = false;
+
+    static typing_bucket_t last_typing = TYPING_IDLE;
+    typing_bucket_t const typing = typing_bucket(timer_read32());
+    if (typing != last_typing)
+    {
+        last_typing = typing;
+        oled_invalid |= OLED_INVALID_TAP;
+    }
+
+    if (anim_timer_due())
+    {
+        oled_invalid |= OLED_INVALID_TICK;
+    }
+}
+
+static void render_sprite(void)
+{
+    if (timer_elapsed32(oled_tap_timer) > OLED_TIMEOUT)
+    {
+#ifdef OLED_DECODE_BUDGET
+        // Complete the frame so its blocks are flushed when turned on
+        if (decoding)
+        {
+            step_frame(UINT16_MAX);
+        }
+#endif
+        ticking = false;
+        late = false;
+        oled_off();
+        return;
+    }
+
+    // The tick is only taken once its frame is complete, but timed from
+    // the pass that began the frame. A tick that came due while the last
+    // frame decoded is timed from when it was due, so its frame is
+    // delayed rather than dropped and later frames catch up.
+    bool const tick = oled_invalid & OLED_INVALID_TICK;
+    uint16_t const last_duration = duration;
+    duration = animate_sprite(tick);
+    if (tick && !ticking)
+    {
+        tick_timer = late ? anim_timer + last_duration : anim_timer_read();
+        ticking = true;
+    }
+    if (tick && !decoding)
+    {
+        anim_timer = tick_timer;
+        ticking = false;
+        late = anim_timer_due();
+    }
+}
+
+// QMK runs no user hooks for the state synced to the secondary half
+// by "oled-sync.c", so changes are found by comparing it with the last
+// render. Modifiers have no hook on either half.
+static void track_inputs(void)
+{
+    static uint8_t last_mods = 0;
+    uint8_t mods = get_mods();
+#ifndef NO_ACTION_ONESHOT
+    mods |= get_oneshot_mods();
+#endif
+    if (mods != last_mods)
+    {
+        last_mods = mods;
+        oled_invalid |= OLED_INVALID_MODS;
+    }
+
+    if (!is_keyboard_master())
+    {
+        static layer_state_t last_layer = 0;
+        static bool last_caps = false;
+        if (layer_state != last_layer)
+        {
+            last_layer = layer_state;
+            oled_invalid |= OLED_INVALID_LAYER;
+        }
+        if (oled_status.caps_lock != last_caps)
+        {
+            last_caps = oled_status.caps_lock;
+            oled_invalid |= OLED_INVALID_LED;
+        }
+    }
+}
+
+// Init and rendering calls
+oled_rotation_t oled_init_user(oled_rotation_t const rotation)
+{
+    if (is_keyboard_master() || SPRITE_SECONDARY)
+    {
+        return is_keyboard_left() ? oled_sprite.rotation_left : oled_sprite.rotation_right;
+    }
+    else
+    {
+        return OLED_ROTATION_270;
+    }
+}
+
+bool oled_task_user(void)
+{
+    extern void render_mod_status(void);
+    uint32_t const start = oled_profile_start();
+
+    // Key taps and animation ticks only matter to the sprite
+    track_inputs();
+    if (is_keyboard_master() || SPRITE_SECONDARY)
+    {
+        tick_sprite();
+    }
+    else
+    {
+        oled_invalid &= OLED_INVALID_LAYER | OLED_INVALID_MODS | OLED_INVALID_LED;
+    }
+    if (!oled_invalid)
+    {
+        ++oled_skipped_renders;
+        return false;
+    }
+
+    ++oled_renders;
+    bool const sprite = is_keyboard_master() || SPRITE_SECONDARY;
+    if (sprite)
+    {
+        render_sprite();
+        oled_profile_render(shown, start);
+    }
+    else
+    {
+        render_mod_status();
+        oled_profile_status(start);
+    }
+    // Inputs stay invalid to render again until the sprite frame is
+    // complete
+    if (!sprite || !decoding)
+    {
+        oled_invalid = 0;
+    }
+    return false;
+}
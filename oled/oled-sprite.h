@@ -0,0 +1,75 @@
+// Copyright 2022 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* State tables for the sprite animation engine in "oled-sprite.c".
+
+   A pet is a list of states in PROGMEM. Every frame the engine shows
+   the first state whose entry condition holds, so the last state
+   should be SPRITE_ALWAYS. A state is entered when any of its
+   conditions hold:
+     interval  Milliseconds since the last key tap is below interval
+     mods      Any of these modifiers are held, including one shot
+     flags     SPRITE_CAPS while caps lock is on, SPRITE_ALWAYS,
+               SPRITE_TYPING while "oled-typing.c" finds typing active,
+               SPRITE_SLOWING while typing is active or slowing
+
+   Frames of a state are an "oled-codec.h" container, whose codec is
+   chosen per frame by "rle.c". They play from frame 0 on entering the
+   state and advance every duration milliseconds, so XOR deltas of the
+   previous frame can be used.
+ */
+
+#pragma once
+
+#include QMK_KEYBOARD_H
+
+#define SPRITE_ALWAYS 0x01
+#define SPRITE_CAPS 0x02
+#define SPRITE_TYPING 0x04
+#define SPRITE_SLOWING 0x08
+
+typedef struct
+{
+    unsigned char const *frames;
+    uint16_t duration;
+    uint16_t interval;
+    uint8_t mods;
+    uint8_t flags;
+} sprite_state_t;
+
+typedef struct
+{
+    sprite_state_t const *states; // PROGMEM table, first match is shown
+    uint8_t count;
+    uint16_t start;                // OLED buffer index of the frames
+    uint8_t mirror_left;           // 'decode_frame()' mirror on the left half
+    oled_rotation_t rotation_left; // Primary OLED rotation per half
+    oled_rotation_t rotation_right;
+    void (*render)(void);          // Optional, called on every render
+} sprite_t;
+
+// Defined by the pet module linked with the engine
+extern sprite_t const oled_sprite;
+
+// Time of the last key tap, kept current by 'process_record_user()'
+extern uint32_t oled_tap_timer;
+
+// Inputs that invalidate the OLED. Frames are only rendered after one
+// of them changed, passes with nothing to draw return immediately.
+#define OLED_INVALID_LAYER 0x01
+#define OLED_INVALID_MODS 0x02
+#define OLED_INVALID_LED 0x04
+#define OLED_INVALID_TAP 0x08
+#define OLED_INVALID_TICK 0x10
+
+// Mark inputs changed, for 'layer_state_set_user()', 'led_update_user()'
+// and 'process_record_user()' hooks
+void oled_invalidate(uint8_t const inputs);
+
+// Count of 'oled_task_user()' passes that rendered or were skipped
+extern uint32_t oled_renders;
+extern uint32_t oled_skipped_renders;
+
+// Bytes the driver sends to the panel for the last complete sprite
+// frame, whole blocks the frame changed
+extern uint16_t oled_frame_bytes;
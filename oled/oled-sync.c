@@ -0,0 +1,184 @@
+// Copyright 2022 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Secondary OLED status over one custom split transaction. The primary
+   half packs layers, modifiers, caps lock, OLED power and the age of
+   the last key tap into a 32-bit word and sends it when it changes,
+   instead of the separate layer, modifier, LED and OLED syncs that run
+   every scan. An unchanged status is re-sent every OLED_SYNC_RESEND
+   milliseconds, so a secondary half that reset or reconnected catches
+   up without waiting for a change. The tap age counts up for seconds
+   after every tap, so it only goes out with other changes and the
+   resend. The transport only copies the status in, and it is applied
+   from the task loop of the secondary half.
+
+   Usage guide
+   1 Add the following line into rules.mk:
+        SRC += oled-sync.c
+   2 Replace SPLIT_LAYER_STATE_ENABLE, SPLIT_MODS_ENABLE,
+     SPLIT_LED_STATE_ENABLE and SPLIT_OLED_ENABLE in config.h with:
+        #define SPLIT_TRANSACTION_IDS_USER OLED_SYNC_STATUS
+   3 Call 'oled_sync_init()' from 'keyboard_post_init_user()' and
+     'oled_sync_task()' from 'housekeeping_task_user()' on both halves.
+   4 The secondary half reads the status from:
+        extern oled_status_t oled_status;
+     Layer state and modifiers are also applied to 'layer_state' and
+     'get_mods()', and the OLED is turned on and off with the primary.
+     Only layers 0 to 7 are carried, which is checked against
+     LAYER_COUNT when config.h defines it.
+   5 The resend interval defaults to 2 seconds, or define in config.h:
+        #define OLED_SYNC_RESEND 5000
+     Status bytes sent in the last second are counted in:
+        extern uint16_t oled_sync_rate;
+   6 With OLED_SPRITE_SECONDARY defined in config.h the status also
+     carries the synced time of the last tap, which drives the sprite
+     engine of "oled-sprite.c" on the secondary half.
+ */
+
+#include QMK_KEYBOARD_H
+#include "transactions.h"
+#include "oled-sprite.h"
+#include "oled-sync.h"
+#include "oled-typing.h"
+
+#ifndef OLED_SYNC_RESEND
+#define OLED_SYNC_RESEND 2000 // milliseconds
+#endif
+
+oled_status_t oled_status = {0};
+uint16_t oled_sync_rate = 0;
+
+#ifdef LAYER_COUNT
+_Static_assert(LAYER_COUNT <= 8, "The synced status only carries layers 0 to 7");
+#endif
+
+// Status copied in by the transport, applied from 'oled_sync_task()'
+static oled_status_t received_status;
+static volatile bool status_pending = false;
+
+#ifdef OLED_SPRITE_SECONDARY
+#define SATURATED_AGE ((uint32_t)OLED_SYNC_TAP_MAX * OLED_SYNC_TAP_STEP)
+
+// Tap time of the last status received, re-sent statuses carry it unchanged
+static uint16_t received_tap_time = 0;
+static bool received = false;
+#endif
+
+static void receive_status(uint8_t const in_len, void const *in_data, uint8_t const out_len, void *out_data)
+{
+    if (in_len == sizeof(received_status))
+    {
+        memcpy(&received_status, in_data, sizeof(received_status));
+        status_pending = true;
+    }
+}
+
+static void apply_status(void)
+{
+    // Cleared first, so a status received during the copy is applied
+    // again on the next pass
+    status_pending = false;
+    memcpy(&oled_status, &received_status, sizeof(oled_status));
+
+    layer_state = oled_status.layers;
+    set_mods(oled_status.mods);
+#ifndef NO_ACTION_ONESHOT
+    set_oneshot_mods(oled_status.oneshot_mods);
+#endif
+    oled_status.oled_on ? oled_on() : oled_off();
+
+#ifdef OLED_SPRITE_SECONDARY
+    // Only a new tap time is a tap. The synced timer offset moves by a
+    // millisecond or so on every resync, so ages of re-sent statuses
+    // would otherwise record taps that never happened.
+    if (received && oled_status.tap_time == received_tap_time)
+    {
+        return;
+    }
+    received = true;
+    received_tap_time = oled_status.tap_time;
+
+    // Tap time on the local timer. The 16-bit age wraps after 65.5
+    // seconds, so a saturated age is taken as the age it saturated at,
+    // within OLED_TIMEOUT to leave turning off to the primary.
+    uint16_t age = sync_timer_read() - oled_status.tap_time;
+    if (oled_status.tap_age == OLED_SYNC_TAP_MAX)
+    {
+        age = SATURATED_AGE < OLED_TIMEOUT ? SATURATED_AGE : OLED_TIMEOUT;
+    }
+    // A tap already on the local timer is not recorded twice
+    uint32_t const tap = timer_read32() - age;
+    if (tap != oled_tap_timer)
+    {
+        oled_tap_timer = tap;
+        typing_record(oled_tap_timer);
+        oled_invalidate(OLED_INVALID_TAP);
+    }
+#endif
+}
+
+void oled_sync_init(void)
+{
+    transaction_register_rpc(OLED_SYNC_STATUS, receive_status);
+}
+
+static oled_status_t read_status(void)
+{
+    uint32_t const age = timer_elapsed32(oled_tap_timer) / OLED_SYNC_TAP_STEP;
+    oled_status_t status = {0};
+
+    status.layers = layer_state;
+    status.mods = get_mods();
+#ifndef NO_ACTION_ONESHOT
+    status.oneshot_mods = get_oneshot_mods();
+#endif
+    status.caps_lock = host_keyboard_led_state().caps_lock;
+    status.oled_on = is_oled_on();
+    status.tap_age = age < OLED_SYNC_TAP_MAX ? age : OLED_SYNC_TAP_MAX;
+#ifdef OLED_SPRITE_SECONDARY
+    // The primary timer is the synced timer
+    status.tap_time = oled_tap_timer;
+#endif
+    return status;
+}
+
+void oled_sync_task(void)
+{
+    static uint32_t window = 0;
+    static uint32_t sent_timer = 0;
+    static uint16_t bytes = 0;
+    static bool sent = false;
+
+    if (!is_keyboard_master())
+    {
+        if (status_pending)
+        {
+            apply_status();
+        }
+        return;
+    }
+
+    // The age alone is no change, it moves every OLED_SYNC_TAP_STEP
+    oled_status_t const status = read_status();
+    oled_status_t aged = status;
+    aged.tap_age = oled_status.tap_age;
+    bool const changed = !sent || memcmp(&aged, &oled_status, sizeof(aged));
+    if (changed || timer_elapsed32(sent_timer) >= OLED_SYNC_RESEND)
+    {
+        // Keep the last status to retry if the link was busy
+        if (transaction_rpc_send(OLED_SYNC_STATUS, sizeof(status), &status))
+        {
+            oled_status = status;
+            sent_timer = timer_read32();
+            bytes += sizeof(status);
+            sent = true;
+        }
+    }
+
+    if (timer_elapsed32(window) >= 1000)
+    {
+        window = timer_read32();
+        oled_sync_rate = bytes;
+        bytes = 0;
+    }
+}
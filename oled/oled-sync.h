@@ -0,0 +1,45 @@
+// Copyright 2022 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Packed status word synced to the secondary half, see "oled-sync.c" */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct
+{
+    union
+    {
+        uint32_t raw;
+        struct
+        {
+            uint8_t layers;       // layer_state of layers 0 to 7
+            uint8_t mods;         // get_mods()
+            uint8_t oneshot_mods; // get_oneshot_mods()
+            bool caps_lock : 1;
+            bool oled_on : 1;
+            uint8_t tap_age : 6;  // OLED_SYNC_TAP_STEP ms since the last tap, saturated
+        };
+    };
+#ifdef OLED_SPRITE_SECONDARY
+    uint16_t tap_time; // 'sync_timer_read()' of the last tap, also fed to "oled-typing.c"
+#endif
+} __attribute__((packed)) oled_status_t;
+
+#define OLED_SYNC_TAP_STEP 250
+#define OLED_SYNC_TAP_MAX 63
+
+// Last status sent by the primary or received by the secondary half
+extern oled_status_t oled_status;
+
+// Status bytes put on the split link in the last full second
+extern uint16_t oled_sync_rate;
+
+// Register the transaction, call from 'keyboard_post_init_user()'
+void oled_sync_init(void);
+// Send the status when it changed or is due to be re-sent, or apply the
+// status received on the secondary half, call from
+// 'housekeeping_task_user()'
+void oled_sync_task(void);
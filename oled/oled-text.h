@@ -0,0 +1,105 @@
+// Generated by "fontsubset.c", do not edit. Regenerate with:
+// ./fontsubset -o oled/oledfont-subset.c -m oled/oledfont-map.h -t oled/oled-text.h -r qmk_logo@32 -r layer_icons@32 -r corne_logo@32 -r corne_label@32 -r katakana@32 oled/oledfont.c oled/oled-icons.c oled/oled-luna.c
+
+#pragma once
+
+// "qmk_logo" drawn on 32 pixel lines
+#define QMK_LOGO_RAW_LINES 13
+#define QMK_LOGO_RAW { \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, \
+    0xF8, 0x18, 0x00, 0xC0, 0xF0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+    0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x04, 0x22, \
+    0x52, 0xE2, 0x42, 0x42, 0x42, 0xE2, 0x52, 0x22, 0x22, 0x22, 0x42, 0x82, \
+    0x02, 0x02, 0x22, 0x22, 0x02, 0x04, 0xF8, 0x00, 0x00, 0xF8, 0x04, 0x02, \
+    0x02, 0x82, 0x00, 0x00, 0x42, 0x22, 0x42, 0x82, 0x02, 0x02, 0x02, 0x82, \
+    0x42, 0x22, 0x12, 0x22, 0x42, 0x82, 0x02, 0x04, 0xF8, 0x00, 0x00, 0xF8, \
+    0xFC, 0xDE, 0xAE, 0x1E, 0xBE, 0xBE, 0xBE, 0x1E, 0xAE, 0xDE, 0x00, 0x00, \
+    0xDE, 0xDE, 0xBE, 0x7E, 0xFE, 0xFE, 0xDE, 0xDE, 0xFE, 0xFC, 0xF8, 0x00, \
+    0x00, 0xF8, 0xFC, 0xFE, 0xFE, 0x7E, 0xBE, 0xDE, 0xBE, 0x7E, 0xFE, 0xFE, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40, \
+    0x20, 0x20, 0x00, 0xF8, 0xFC, 0xFE, 0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, \
+    0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+    0xFF, 0x1F, 0x00, 0x00, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, \
+    0x20, 0x44, 0x4A, 0x47, 0x42, 0x42, 0x42, 0x47, 0x4A, 0x44, 0x40, 0x40, \
+    0x40, 0x40, 0x41, 0x42, 0x44, 0x44, 0x40, 0x20, 0x1F, 0x00, 0x00, 0x00, \
+    0x00, 0x1F, 0x20, 0x40, 0x41, 0x40, 0x40, 0x40, 0x40, 0x40, 0x41, 0x40, \
+    0x41, 0x41, 0x4F, 0x48, 0x48, 0x48, 0x4F, 0x41, 0x41, 0x20, 0x1F, 0x00, \
+    0x00, 0x1F, 0x3F, 0x7B, 0x75, 0x78, 0x00, 0x00, 0x7D, 0x7D, 0x7D, 0x78, \
+    0x75, 0x7B, 0x7F, 0x7F, 0x7F, 0x7F, 0x7E, 0x7D, 0x7B, 0x7B, 0x7F, 0x3F, \
+    0x1F, 0x00, 0x00, 0x1F, 0x3F, 0x7F, 0x7E, 0x7F, 0x7F, 0x7F, 0x7F, 0x7F, \
+    0x7E, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, \
+    0x5D, 0x5D, 0x3E, 0x3E, 0x00, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, \
+    0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x00, 0x00, \
+    0x3F, 0x7F, 0x7F, 0x7F, 0x7F, 0x7C, 0x78, 0x78, 0x38, 0x1C, 0x0F, 0x00, \
+    0x04, 0xF8, 0x00, 0x00, 0xF8, 0x04, 0x20, 0x1F, 0x00, 0x00, 0x1F, 0x20, \
+    0xFC, 0xF8, 0x00, 0x00, 0xF8, 0x04, 0x00, 0x00, 0x3F, 0x1F, 0x00, 0x00, \
+    0x1F, 0x20, 0x04, 0xF8, 0x00, 0x00, 0xF8, 0xFC, 0x20, 0x1F, 0x00, 0x00, \
+    0x1F, 0x3F, 0xFC, 0xF8, 0x00, 0x00, 0xF8, 0xFC, 0x3F, 0x1F, 0x00, 0x00, \
+    0x1F, 0x3F, 0x00, 0x00, 0xFE, 0x7E, 0xBE, 0xDE, 0xEE, 0xDE, 0xBE, 0x7E, \
+    0xFE, 0xFC, 0xF8, 0x00, 0x7E, 0x7E, 0x70, 0x77, 0x77, 0x77, 0x70, 0x7E, \
+    0x7E, 0x3F, 0x1F, 0x00, 0x22, 0x22, 0x22, 0x22, 0x3E, 0x00, 0x00, 0x00, \
+    0x20, 0x1E, 0x00, 0x3E, 0x10, 0x00, 0x22, 0x12, 0x7B, 0x0A, 0x16, 0x00, \
+    0x00, 0x00, 0x01, 0x01, 0x02, 0x02}
+
+// "layer_icons" drawn on 32 pixel lines
+#define LAYER_ICONS_RAW_LINES 3
+#define LAYER_ICONS_RAW_SIZE 94
+#define LAYER_ICONS_RAW {{ \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, \
+    0x10, 0x10, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x88, 0x88, 0xD5, 0xD5, 0xE2, 0xE2, 0xC4, 0xC4, 0x88, 0x88, \
+    0xC4, 0xC4, 0xE2, 0xE2, 0xD5, 0xD5, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x01, 0x01, 0x03, 0x03, 0x07, 0x07, 0x0F, 0x0F, 0x07, 0x07, 0x03, 0x03, \
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, { \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, \
+    0x10, 0x10, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x88, 0x88, 0x5D, 0x5D, 0x3E, 0x3E, 0x7C, 0x7C, 0xF8, 0xF8, \
+    0x7C, 0x7C, 0x3E, 0x3E, 0x5D, 0x5D, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, \
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, { \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xC0, 0xC0, 0xE0, 0xE0, \
+    0xF0, 0xF0, 0xF8, 0xF8, 0xF0, 0xF0, 0xE0, 0xE0, 0xC0, 0xC0, 0x80, 0x80, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x88, 0x88, 0x55, 0x55, 0x23, 0x23, 0x47, 0x47, 0x8F, 0x8F, \
+    0x47, 0x47, 0x23, 0x23, 0x55, 0x55, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x04, 0x04, 0x02, 0x02, \
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, { \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0xC0, 0x60, 0xA0, \
+    0x50, 0xB0, 0x58, 0xA8, 0x50, 0xB0, 0x60, 0xA0, 0x40, 0xC0, 0x80, 0x80, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x88, 0x88, 0x5D, 0xD5, 0x6B, 0xB6, 0x6D, 0xD6, 0xAD, 0xDA, \
+    0x6D, 0xD6, 0x6B, 0xB6, 0x5D, 0xD5, 0x88, 0x88, 0x00, 0x00, 0x00, 0x00, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, \
+    0x01, 0x01, 0x03, 0x02, 0x05, 0x06, 0x0D, 0x0A, 0x05, 0x06, 0x03, 0x02, \
+    0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}}
+
+// "corne_logo" drawn on 32 pixel lines
+#define CORNE_LOGO_RAW_LINES 3
+#define CORNE_LOGO_RAW { \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF0, 0xF8, \
+    0xF8, 0x18, 0x00, 0xC0, 0xF0, 0xFC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, \
+    0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0xFE, \
+    0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, \
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x07, 0x01, 0x00, 0x00, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0F, 0x1F, 0x3F, 0x3F, 0x3F, 0x3F, \
+    0x1F, 0x1F, 0x3F, 0x3F, 0x7F, 0x7F, 0x7F, 0x3F, 0x3F, 0x1F, 0x3F, 0x7F, \
+    0x7F, 0x7F, 0x7F, 0x7C, 0x78, 0x78, 0x38, 0x1C, 0x0F, 0x00}
+
+// "corne_label" drawn on 32 pixel lines
+#define CORNE_LABEL_RAW_LINES 1
+#define CORNE_LABEL_RAW { \
+    0x38, 0x44, 0x44, 0x44, 0x28, 0x00, 0x38, 0x44, 0x44, 0x44, 0x38, 0x00, \
+    0x7C, 0x08, 0x04, 0x04, 0x08, 0x00, 0x7C, 0x08, 0x04, 0x04, 0x78, 0x00, \
+    0x38, 0x54, 0x54, 0x54, 0x18, 0x00}
+
+// "katakana" drawn on 32 pixel lines
+#define KATAKANA_RAW_LINES 1
+#define KATAKANA_RAW { \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x3E, 0x00, \
+    0x20, 0x1E, 0x00, 0x3E, 0x10, 0x00, 0x22, 0x12, 0x7B, 0x0A, 0x16, 0x00, \
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
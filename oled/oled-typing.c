@@ -0,0 +1,126 @@
+// Copyright 2022 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Typing speed estimator from key press time stamps. QMK's WPM is a
+   smoothed average that lags real typing by seconds, so animations
+   polling it start late and keep going long after typing stopped.
+   Here each key updates an exponentially weighted average of the
+   interval between keys, and activity is bucketed the moment the
+   current gap outgrows it:
+     TYPING_ACTIVE   Gap within twice the average, up to TYPING_SLOW_INTERVAL
+     TYPING_SLOWING  Longer gap, up to TYPING_IDLE_TIME
+     TYPING_IDLE     No key for longer, or none yet
+   With TYPING_WPM, the last TYPING_RING_SIZE time stamps also give a
+   windowed WPM.
+
+   Usage guide
+   1 Add the following line into rules.mk:
+        SRC += oled-typing.c
+   2 Include "oled-typing.h" and record key presses from
+     'process_record_user()' in keymap.c:
+        if (record->event.pressed) {
+            typing_record(timer_read32());
+        }
+   3 Read 'typing_bucket(timer_read32())'. The sprite engine of
+     "oled-sprite.c" enters SPRITE_TYPING and SPRITE_SLOWING states from
+     the bucket.
+   4 The windowed WPM keeps TYPING_RING_SIZE time stamps in RAM and is
+     left out by default. To read 'typing_wpm(timer_read32())', add the
+     following line into config.h:
+        #define TYPING_WPM
+ */
+
+#include "oled-typing.h"
+
+#ifdef TYPING_WPM
+#define TYPING_RING_MASK (TYPING_RING_SIZE - 1)
+
+static uint32_t ring[TYPING_RING_SIZE];
+static uint8_t head = 0;
+
+static uint32_t last_key(void)
+{
+    return ring[(head - 1) & TYPING_RING_MASK];
+}
+#else
+static uint32_t last = 0;
+#define last_key() last
+#endif
+
+// Keys recorded, up to TYPING_RING_SIZE
+static uint8_t count = 0;
+// Average milliseconds between keys, weighted 1/4 to the newest
+static uint16_t interval = TYPING_SLOW_INTERVAL;
+
+void typing_reset(void)
+{
+    count = 0;
+    interval = TYPING_SLOW_INTERVAL;
+}
+
+void typing_record(uint32_t const time)
+{
+    if (count)
+    {
+        uint32_t const gap = time - last_key();
+        // Keys arriving out of order, such as coalesced split packets
+        if ((int32_t)gap < 0)
+        {
+            return;
+        }
+        if (gap > TYPING_IDLE_TIME)
+        {
+            // A new burst starts from a slow average, so its first key
+            // is active for TYPING_SLOW_INTERVAL
+            typing_reset();
+        }
+        else
+        {
+            int16_t const sample = gap < TYPING_SLOW_INTERVAL ? gap : TYPING_SLOW_INTERVAL;
+            interval += (sample - (int16_t)interval) / 4;
+        }
+    }
+
+#ifdef TYPING_WPM
+    ring[head] = time;
+    head = (head + 1) & TYPING_RING_MASK;
+#else
+    last = time;
+#endif
+    if (count < TYPING_RING_SIZE)
+    {
+        ++count;
+    }
+}
+
+typing_bucket_t typing_bucket(uint32_t const now)
+{
+    if (!count)
+    {
+        return TYPING_IDLE;
+    }
+
+    uint32_t const gap = now - last_key();
+    uint16_t const active = interval * 2 < TYPING_SLOW_INTERVAL ? interval * 2 : TYPING_SLOW_INTERVAL;
+    if (gap <= active)
+    {
+        return TYPING_ACTIVE;
+    }
+    return gap <= TYPING_IDLE_TIME ? TYPING_SLOWING : TYPING_IDLE;
+}
+
+#ifdef TYPING_WPM
+uint8_t typing_wpm(uint32_t const now)
+{
+    if (count < 2 || now - last_key() > TYPING_IDLE_TIME)
+    {
+        return 0;
+    }
+
+    // Intervals in the ring over the time since its oldest key, so the
+    // rate falls while the current gap grows. A word is 5 keys.
+    uint32_t const span = now - ring[(head - count) & TYPING_RING_MASK];
+    uint32_t const wpm = span ? (count - 1) * 12000UL / span : UINT8_MAX;
+    return wpm < UINT8_MAX ? wpm : UINT8_MAX;
+}
+#endif
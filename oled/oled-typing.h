@@ -0,0 +1,39 @@
+// Copyright 2022 @filterpaper
+// SPDX-License-Identifier: GPL-2.0+
+
+/* Typing speed estimator for the sprite engine, see "oled-typing.c" */
+
+#pragma once
+
+#include <stdint.h>
+
+// Milliseconds between keys above which typing is slowing down
+#ifndef TYPING_SLOW_INTERVAL
+#define TYPING_SLOW_INTERVAL 400
+#endif
+// Milliseconds without keys before typing is idle
+#ifndef TYPING_IDLE_TIME
+#define TYPING_IDLE_TIME 1600
+#endif
+// Key time stamps kept for the windowed rate of TYPING_WPM, a power of 2
+#ifndef TYPING_RING_SIZE
+#define TYPING_RING_SIZE 8
+#endif
+
+typedef enum
+{
+    TYPING_IDLE,
+    TYPING_SLOWING,
+    TYPING_ACTIVE,
+} typing_bucket_t;
+
+// Record a key press at time, from 'process_record_user()'
+void typing_record(uint32_t const time);
+// Activity at time now
+typing_bucket_t typing_bucket(uint32_t const now);
+#ifdef TYPING_WPM
+// Words per minute over the key time stamps in the ring
+uint8_t typing_wpm(uint32_t const now);
+#endif
+// Forget every key
+void typing_reset(void);
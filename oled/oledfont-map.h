@@ -0,0 +1,15 @@
+// Generated by "fontsubset.c", do not edit. Regenerate with:
+// ./fontsubset -o oled/oledfont-subset.c -m oled/oledfont-map.h -t oled/oled-text.h -r qmk_logo@32 -r layer_icons@32 -r corne_logo@32 -r corne_label@32 -r katakana@32 oled/oledfont.c oled/oled-icons.c oled/oled-luna.c
+
+#pragma once
+
+// Glyphs drawn into "oled/oled-text.h" are left out
+#define OLED_FONT_MAP_TEXT_RAW
+
+#define OLED_FONT_MAP_FIRST 0x20
+#define OLED_FONT_MAP_LAST 0x20
+
+// Subset glyph of every character code from OLED_FONT_MAP_FIRST
+static uint8_t const font_map[OLED_FONT_MAP_LAST - OLED_FONT_MAP_FIRST + 1] PROGMEM = {
+    0
+};
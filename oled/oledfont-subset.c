@@ -0,0 +1,13 @@
+// Generated by "fontsubset.c", do not edit. Regenerate with:
+// ./fontsubset -o oled/oledfont-subset.c -m oled/oledfont-map.h -t oled/oled-text.h -r qmk_logo@32 -r layer_icons@32 -r corne_logo@32 -r corne_label@32 -r katakana@32 oled/oledfont.c oled/oled-icons.c oled/oled-luna.c
+
+#include "progmem.h"
+
+#if OLED_FONT_START != 0 || OLED_FONT_END != 0
+#error "The subset font needs OLED_FONT_START 0 and OLED_FONT_END 0"
+#endif
+
+// Glyphs of "oled/oledfont.c" written by the userspace, see "oledfont-map.h"
+static unsigned char const font[] PROGMEM = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
@@ -1,97 +1,213 @@
 // Copyright 2021 @vectorstorm
 // SPDX-License-Identifier: GPL-2.0+
 
+/* OLED asset compiler. Reads netpbm frames or sprite sheets and writes
+   a header of "oled-codec.h" animation containers, searching every
+   codec and LZ window for the smallest encoding of each frame within a
+   decode cycle ceiling, and printing a flash report to stderr. Frames
+   are encoded on a pool of worker threads, and the output does not
+   depend on their number.
+
+   Build and run from the userspace root:
+        cc -O2 -pthread -o rle oled/rle.c host/pbm.c
+        ./rle [-s WxH] [-r] [-l] [-c codec,...] [-d cycles] [-b budget] [-j threads] [-x] [-m manifest]
+            [-o header] name=image[@frame,...] ...
+
+   -s WxH     Frame size in pixels, height a multiple of 8 (default 128x32)
+   -r         Pre-rotate frames for a display that would use
+              OLED_ROTATION_90 or 270, to be drawn in OLED_ROTATION_0 or
+              180 respectively. -s stays the unrotated size.
+   -l         Also emit a column mirrored left_name of every animation
+   -c codecs  Codecs to try from raw,rle,delta,lz (default all), raw is
+              always the fallback. Applies to the animations after it.
+   -d cycles  Skip encodings estimated to decode in more than cycles AVR
+              cycles per frame, see frame_cycles(). Raw is still the
+              fallback. Applies to the animations after it.
+   -b budget  Static assert that all animations fit in budget bytes
+   -x         Also report the flash of every animation with the greedy
+              RLE encoder this replaced and with every RLE header layout.
+              The header is always written with the classic layout.
+   -j threads Worker threads, defaults to the online CPUs
+   -m file    Write the codec, LZ window, size and decode cycles chosen
+              for every frame to a manifest
+   -o header  Output file, defaults to stdout
+
+   Images are plain or raw PBM (P1, P4) or PGM (P2, P5) and dark pixels
+   light up the OLED. Sheets are split into frames left to right, top to
+   bottom, and '@' lists the playback order, e.g. idle=idle.pbm@0,0,1,2.
+   Convert PNG art first with 'pngtopnm art.png | pgmtopbm > art.pbm'.
+ */
+
+#include <stdatomic.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "oled-codec.h"
+#include "../host/pbm.h"
+
+#define MAX_FRAME_SIZE 1024 // 128x64 OLED
+#define MAX_FRAMES 64
+#define MAX_ANIMATIONS 64
+
+typedef struct
+{
+    char name[64];
+    char source[256];
+    int count;
+    int codecs;
+    int width;
+    int height;
+    int rotate;
+    long ceiling;
+    unsigned char frames[MAX_FRAMES][MAX_FRAME_SIZE];
+} animation_t;
+
+typedef struct
+{
+    size_t raw;
+    size_t packed;
+    int codecs[4];
+} report_t;
+
+#define CODEC_BIT(codec) (1 << (codec))
+#define CODECS_ALL (CODEC_BIT(OLED_CODEC_RAW) | CODEC_BIT(OLED_CODEC_RLE) | CODEC_BIT(OLED_CODEC_DELTA) | CODEC_BIT(OLED_CODEC_LZ))
+
+static const char *const codec_names[] = {"raw", "rle", "delta", "lz"};
+
+// Per thread, so workers can encode animations of different sizes
+static _Thread_local int frame_width = 128;
+static _Thread_local int frame_height = 32;
+static _Thread_local size_t frame_size = 512;
+static _Thread_local int rotate = 0;
+
+// Frame geometry of an animation for the encoders
+static void use_animation(const animation_t *anim)
+{
+    frame_width = anim->width;
+    frame_height = anim->height;
+    frame_size = frame_width * frame_height / 8;
+    rotate = anim->rotate;
+}
+
+// Columns per page of an encoded frame
+static int page_columns(void)
+{
+    return rotate ? frame_height : frame_width;
+}
 
-#define IDLE_FRAMES 4
-#define IDLE_SPEED 20 // below this wpm value your animation will idle
-
-// #define PREP_FRAMES 1 // uncomment if >1
-
-#define TAP_FRAMES 2
-#define TAP_SPEED 40  // above this wpm value typing animation to trigger
-#define MAX_SPEED 100 // above this wpm value typing animation to trigger
-
-#define ANIM_FRAME_DURATION 200      // how long each frame lasts in ms
-#define TAP_FRAME_DURATION 400       // how long each frame lasts in ms
-#define TAP_FRAME_DURATION_WPMMOD -3 // how long each frame lasts in ms
-// #define SLEEP_TIMER 60000 // should sleep after this period of 0 wpm, needs fixing
-#define ANIM_SIZE 512 // number of bytes in array, minimize for adequate firmware size, max is 1024
-
-int values[256];
-
-static const unsigned char idle[IDLE_FRAMES][ANIM_SIZE] = {
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x20, 0x18, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc1, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x80, 0x80, 0x40, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x83, 0x83, 0x40, 0x40, 0x40, 0x40, 0x20, 0x21, 0x21, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x30, 0x40, 0x80, 0x80, 0x00, 0x00, 0x01, 0x86, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x41, 0x42, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x40, 0x40, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc1, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x86, 0x86, 0x40, 0x40, 0x40, 0x40, 0x21, 0x22, 0x22, 0x20, 0x11, 0x11, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x30, 0x40, 0x80, 0x80, 0x00, 0x00, 0x01, 0x86, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x41, 0x42, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x82, 0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 0x00, 0x60, 0x60, 0x00, 0x01, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x86, 0x86, 0x40, 0x40, 0x40, 0x40, 0x21, 0x22, 0x22, 0x20, 0x11, 0x11, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x30, 0x40, 0x80, 0x80, 0x00, 0x00, 0x01, 0x86, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x41, 0x42, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x34, 0xc4, 0x04, 0x04, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x02, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x80, 0x80, 0x40, 0x00, 0x00, 0x30, 0x30, 0x00, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x83, 0x83, 0x40, 0x40, 0x40, 0x40, 0x20, 0x21, 0x21, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x30, 0x40, 0x80, 0x80, 0x00, 0x00, 0x01, 0x86, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x41, 0x42, 0x24, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-static const unsigned char prep[][ANIM_SIZE] = {
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc1, 0x01, 0x01, 0x02, 0x02, 0x04, 0x84, 0x44, 0x44, 0x42, 0x82, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x80, 0x80, 0x40, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x64, 0x18, 0x04, 0x12, 0xc2, 0xca, 0x24, 0x88, 0xf0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x06, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x02, 0x18, 0x19, 0x00, 0x05, 0xfe, 0x80, 0x83, 0x83, 0x40, 0x40, 0x40, 0x40, 0x20, 0x21, 0x21, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}};
-static const unsigned char tap[TAP_FRAMES][ANIM_SIZE] = {
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc1, 0x01, 0x01, 0x02, 0x02, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x80, 0x80, 0x40, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x64, 0x18, 0x04, 0x12, 0xc2, 0xca, 0x24, 0x88, 0xf0, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x06, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x83, 0x83, 0x40, 0x40, 0x40, 0x40, 0x20, 0x21, 0x21, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x41, 0x42, 0x24, 0x98, 0xc0, 0x88, 0x88, 0x8c, 0x9c, 0x1c, 0x1e, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
-    {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x40, 0x40, 0x20, 0x20, 0x10, 0x08, 0x04, 0x02, 0x04, 0x08, 0x10, 0x10, 0x20, 0x20, 0x40, 0x40, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc1, 0x01, 0x01, 0x02, 0x02, 0x04, 0x84, 0x44, 0x44, 0x42, 0x82, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x40, 0x80, 0x80, 0x40, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x18, 0x06, 0x01, 0x00, 0x00, 0x0c, 0x03, 0x00, 0x02, 0x18, 0x19, 0x00, 0x05, 0xfe, 0x80, 0x83, 0x83, 0x40, 0x40, 0x40, 0x40, 0x20, 0x21, 0x21, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x08, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x08, 0x30, 0x40, 0x80, 0x80, 0x00, 0x00, 0x01, 0x86, 0x98, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x40, 0x40, 0x40, 0x40, 0x20, 0x20, 0x20, 0x20, 0x10, 0x10, 0x10, 0x10, 0x08, 0x0f, 0x08, 0x08, 0x04, 0x04, 0x04, 0x04, 0x02, 0x02, 0x02, 0x02, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x0f, 0x07, 0x03, 0x03, 0x61, 0xf0, 0xf8, 0xfc, 0x60, 0x01, 0x01, 0x01, 0x3c, 0x78, 0xf8, 0xf0, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00},
+// RLE header layouts. Only "classic" is understood by the decoders in
+// "oled-codec.c", the others are flash experiments reported by -x.
+typedef struct
+{
+    const char *name;
+    int max_run;          // Longest repeat under a one byte header
+    int max_literal;      // Longest literal span under a one byte header
+    int max_pair_run;     // Short repeat and literal span sharing a header,
+    int max_pair_literal; // 0 if the layout has no pairs
+} rle_layout_t;
+
+static const rle_layout_t rle_layouts[] = {
+    // 0x00-0x7f repeat count, 0x80-0xff 0x80 + literal count
+    {"classic", 127, 127, 0, 0},
+    // 0x00-0x3f repeat count - 1, 0x40-0x7f 0x40 + literal count - 1,
+    // 0x80-0xff 0x80 + (repeat count - 1) << 4 + literal count for a
+    // repeat of 1 to 8 bytes followed by 0 to 15 literal bytes
+    {"nibble", 64, 64, 8, 15},
 };
 
-int totalConsecutiveSingleBytes = 0;
-int maxRun = 0;
-int numberOfVals = 0;
-void test_rle_decode(unsigned char *rle, size_t rleN, const unsigned char *original, size_t n)
+#define RLE_LAYOUTS (int)(sizeof(rle_layouts) / sizeof(rle_layouts[0]))
+#define RLE_CLASSIC 0
+#define RLE_NIBBLE 1
+
+// Layout used by rle_encode(), and the greedy encoder it replaced for
+// the -x report
+static _Thread_local int rle_layout = RLE_CLASSIC;
+static _Thread_local int rle_greedy = 0;
+
+// Frames whose stream did not decode back to them, from any thread
+static atomic_int decode_errors;
+
+// Returns -1 and counts a decode error if the stream differs from the frame
+int test_rle_decode(const unsigned char *rle, size_t rleN, const unsigned char *original, size_t n)
 {
-    int cursor = 0;
-    int bytes = (unsigned char)rle[0];
-    unsigned char i = 1;
-    while (i < bytes)
+    int error = 0;
+    size_t cursor = 0;
+    size_t i = 0;
+    while (i < rleN)
     {
+        int run;
+        int literals;
         unsigned char count = rle[i];
         i++;
 
-        if ((count & 0x80) == 0) // duplicates
+        if (rle_layout == RLE_NIBBLE)
+        {
+            run = count & 0x80 ? (count >> 4 & 0x07) + 1 : count & 0x40 ? 0 : count + 1;
+            literals = count & 0x80 ? count & 0x0f : count & 0x40 ? (count & 0x3f) + 1 : 0;
+        }
+        else
+        {
+            run = count & 0x80 ? 0 : count;
+            literals = count & 0x80 ? count & ~(0x80) : 0;
+        }
+
+        // duplicates
+        if (run)
         {
             unsigned char value = rle[i];
             i++;
-            for (int reps = 0; reps < count; reps++)
+            for (int reps = 0; reps < run; reps++)
             {
-                if (original[cursor] != value)
-                    printf("Error at byte %d\n", cursor);
+                if (cursor >= n || original[cursor] != value)
+                {
+                    fprintf(stderr, "Error at byte %zu\n", cursor);
+                    error = 1;
+                }
                 cursor++;
             }
         }
-        else // uniques
+        // uniques
+        for (int uniqs = 0; uniqs < literals; uniqs++)
         {
-            count &= ~(0x80);
-            for (int uniqs = 0; uniqs < count; uniqs++)
+            unsigned char value = rle[i];
+            i++;
+            if (cursor >= n || original[cursor] != value)
             {
-                unsigned char value = rle[i];
-                i++;
-                if (original[cursor] != value)
-                    printf("Error at byte %d\n", cursor);
-                cursor++;
+                fprintf(stderr, "Error at byte %zu\n", cursor);
+                error = 1;
             }
+            cursor++;
         }
     }
+    if (cursor != n)
+    {
+        fprintf(stderr, "Error: decoded %zu of %zu bytes\n", cursor, n);
+        error = 1;
+    }
+    if (error)
+        atomic_fetch_add(&decode_errors, 1);
+    return error ? -1 : 0;
 }
 
-int rle_encode(unsigned char *output, const unsigned char *array, size_t n)
+// Greedy singles versus duplicates choice of the original encoder
+static size_t rle_encode_greedy(unsigned char *output, const unsigned char *array, size_t n)
 {
-
-    size_t rleSize = 1;
+    size_t rleSize = 0;
     size_t index = 0;
-    char runValue = 0;
-    char runOfDups = 0;
-    char runOfSingles = 0;
-    int singleBytes = 0;
 
     while (index < n)
     {
         // first, figure out if we want to put out a runOfSingles or a runOfDups
-        if (index < n - 3 &&
+        if (index + 3 < n &&
             array[index] != array[index + 1] &&
             array[index + 1] != array[index + 2])
         {
             // singles
             unsigned char count = 1;
-            while (count < 126 && index + count < n - 3 && array[index + count] != array[index + count + 1])
+            while (count < 126 && index + count + 3 < n && array[index + count] != array[index + count + 1])
             {
                 count++;
             }
@@ -117,76 +233,811 @@ int rle_encode(unsigned char *output, const unsigned char *array, size_t n)
             index += count;
         }
     }
+    return rleSize;
+}
 
-    output[0] = rleSize;
+// Minimum size RLE parse for the current layout. cost[i] is the size of
+// the best encoding of bytes i to n, built back to front over every
+// repeat, literal span and pair the layout allows at i.
+// Returns the RLE stream length, the container records frame sizes
+size_t rle_encode(unsigned char *output, const unsigned char *array, size_t n)
+{
+    const rle_layout_t *layout = &rle_layouts[rle_layout];
+    size_t cost[MAX_FRAME_SIZE + 1];
+    int run[MAX_FRAME_SIZE];
+    int literals[MAX_FRAME_SIZE];
+    int same[MAX_FRAME_SIZE];
 
-    test_rle_decode(output, rleSize, array, n);
+    if (rle_greedy)
+    {
+        size_t size = rle_encode_greedy(output, array, n);
+        test_rle_decode(output, size, array, n);
+        return size;
+    }
+
+    cost[n] = 0;
+    for (size_t i = n; i-- > 0;)
+    {
+        // Bytes equal to array[i] from i on
+        same[i] = i + 1 < n && array[i] == array[i + 1] ? same[i + 1] + 1 : 1;
+        cost[i] = (size_t)-1;
+
+        for (int r = 1; r <= same[i] && r <= layout->max_run; r++)
+        {
+            if (cost[i + r] + 2 < cost[i])
+            {
+                cost[i] = cost[i + r] + 2;
+                run[i] = r;
+                literals[i] = 0;
+            }
+        }
+        for (int l = 1; l <= layout->max_literal && i + l <= n; l++)
+        {
+            if (cost[i + l] + 1 + l < cost[i])
+            {
+                cost[i] = cost[i + l] + 1 + l;
+                run[i] = 0;
+                literals[i] = l;
+            }
+        }
+        for (int r = 1; r <= same[i] && r <= layout->max_pair_run; r++)
+        {
+            for (int l = 0; l <= layout->max_pair_literal && i + r + l <= n; l++)
+            {
+                if (cost[i + r + l] + 2 + l < cost[i])
+                {
+                    cost[i] = cost[i + r + l] + 2 + l;
+                    run[i] = r;
+                    literals[i] = l;
+                }
+            }
+        }
+    }
 
-    /* int bytes = 0; */
-    /* for ( int i = 2; i < rleSize; i+=2 ) */
-    /* { */
-    /* 	bytes += output[i]; */
-    /* } */
-    /* printf("\nConverting back to %d bytes\n", bytes); */
+    size_t rleSize = 0;
+    for (size_t i = 0; i < n; i += run[i] + literals[i])
+    {
+        if (rle_layout == RLE_NIBBLE)
+        {
+            if (run[i] && literals[i])
+                output[rleSize++] = 0x80 | (run[i] - 1) << 4 | literals[i];
+            else if (run[i])
+                output[rleSize++] = run[i] - 1;
+            else
+                output[rleSize++] = 0x40 | (literals[i] - 1);
+        }
+        else
+        {
+            output[rleSize++] = run[i] ? run[i] : 0x80 | literals[i];
+        }
+
+        if (run[i])
+            output[rleSize++] = array[i];
+        for (int l = 0; l < literals[i]; l++)
+            output[rleSize++] = array[i + run[i] + l];
+    }
+
+    test_rle_decode(output, rleSize, array, n);
     return rleSize;
 }
 
-void print_array(unsigned char *array, int n)
+// XOR frame against the previous frame so unchanged bytes collapse into zero runs
+size_t delta_encode(unsigned char *output, const unsigned char *array, const unsigned char *previous, size_t n)
 {
-    printf("{");
-    for (int i = 0; i < n; i++)
+    unsigned char delta[MAX_FRAME_SIZE];
+
+    for (size_t i = 0; i < n; i++)
+    {
+        delta[i] = array[i] ^ previous[i];
+    }
+    return rle_encode(output, delta, n);
+}
+
+// Returns -1 and counts a decode error if the stream differs from the frame
+int test_lz_decode(const unsigned char *lz, size_t lzN, const unsigned char *original, size_t n)
+{
+    const int length_bits = 16 - lz[0];
+    unsigned char output[MAX_FRAME_SIZE];
+    size_t cursor = 0;
+    size_t i = 1;
+    int items = 0;
+    unsigned char flags = 0;
+
+    while (i < lzN && cursor < n)
+    {
+        if (!items)
+        {
+            flags = lz[i++];
+            items = 8;
+        }
+        if (flags & 1)
+        {
+            output[cursor++] = lz[i++];
+        }
+        else
+        {
+            unsigned match = lz[i] | lz[i + 1] << 8;
+            size_t length = (match & ((1u << length_bits) - 1)) + OLED_LZ_MIN_MATCH;
+            size_t offset = (match >> length_bits) + 1;
+            i += 2;
+            for (; length && cursor < n; length--, cursor++)
+                output[cursor] = offset <= cursor ? output[cursor - offset] : 0;
+        }
+        flags >>= 1;
+        items--;
+    }
+    if (cursor != n || i != lzN || memcmp(output, original, n))
+    {
+        fprintf(stderr, "Error: LZ stream does not decode to its frame\n");
+        atomic_fetch_add(&decode_errors, 1);
+        return -1;
+    }
+    return 0;
+}
+
+// Minimum cost LZSS parse with 2^window_bits offsets, counting 9 bits
+// for a literal and 17 bits for a match including their flag bits
+size_t lz_encode_window(unsigned char *output, const unsigned char *array, size_t n, int window_bits)
+{
+    const int length_bits = 16 - window_bits;
+    const size_t max_offset = (size_t)1 << window_bits;
+    const size_t max_length = ((size_t)1 << length_bits) - 1 + OLED_LZ_MIN_MATCH;
+    size_t cost[MAX_FRAME_SIZE + 1];
+    size_t length[MAX_FRAME_SIZE];
+    size_t offset[MAX_FRAME_SIZE];
+
+    cost[n] = 0;
+    for (size_t i = n; i-- > 0;)
+    {
+        cost[i] = cost[i + 1] + 9;
+        length[i] = 1;
+
+        // Longest match, overlapping the current position like the decoder
+        size_t best = 0;
+        size_t best_offset = 0;
+        for (size_t o = 1; o <= max_offset && o <= i && best < max_length; o++)
+        {
+            size_t m = 0;
+            while (m < max_length && i + m < n && array[i + m] == array[i + m - o])
+                m++;
+            if (m > best)
+            {
+                best = m;
+                best_offset = o;
+            }
+        }
+        for (size_t m = OLED_LZ_MIN_MATCH; m <= best; m++)
+        {
+            if (cost[i + m] + 17 < cost[i])
+            {
+                cost[i] = cost[i + m] + 17;
+                length[i] = m;
+                offset[i] = best_offset;
+            }
+        }
+    }
+
+    size_t size = 0;
+    size_t flags = 0;
+    int items = 8;
+    output[size++] = window_bits;
+    for (size_t i = 0; i < n; i += length[i])
     {
-        if (i == 0)
-            printf("%u", array[i]);
+        if (items == 8)
+        {
+            flags = size;
+            output[size++] = 0;
+            items = 0;
+        }
+        if (length[i] == 1)
+        {
+            output[flags] |= 1 << items;
+            output[size++] = array[i];
+        }
         else
-            printf(", %u", array[i]);
+        {
+            size_t match = (offset[i] - 1) << length_bits | (length[i] - OLED_LZ_MIN_MATCH);
+            output[size++] = match & 0xff;
+            output[size++] = match >> 8;
+        }
+        items++;
     }
-    printf("}");
+
+    test_lz_decode(output, size, array, n);
+    return size;
 }
 
-int max(int x, int y)
+// Reverse columns on each OLED page for the left aligned cat
+void mirror_frame(unsigned char *output, const unsigned char *array, size_t n)
 {
-    return (x > y) ? x : y;
+    const size_t columns = page_columns();
+    for (size_t i = 0; i < n; i++)
+    {
+        output[i] = array[i - i % columns + columns - 1 - i % columns];
+    }
 }
 
-int main(int argc, const char *argv)
+// Transpose a frame as the OLED driver does when flushing a 90 or 270
+// degree rotated buffer, giving frame_height columns by frame_width rows
+void rotate_frame(unsigned char *output, const unsigned char *array)
 {
+    memset(output, 0, frame_size);
+    for (int y = 0; y < frame_height; y++)
+    {
+        for (int x = 0; x < frame_width; x++)
+        {
+            int row = frame_width - 1 - x;
+            if (array[y / 8 * frame_width + x] >> (y % 8) & 1)
+                output[row / 8 * frame_height + y] |= 1 << (row % 8);
+        }
+    }
+}
+
+static void put_word(unsigned char *output, size_t value)
+{
+    output[0] = value & 0xff;
+    output[1] = value >> 8;
+}
 
-    for (int i = 0; i < 255; i++)
-        values[i] = 0;
+// Estimated AVR cycles of the "oled-codec.c" decoders: a PROGMEM read,
+// an OLED buffer byte compared and stored, and the bookkeeping of an RLE
+// run or LZ item. Zero runs of a delta are skipped without writes.
+#define CYCLES_READ 3
+#define CYCLES_BYTE 6
+#define CYCLES_ITEM 40
 
-    char output[128 * 32];
-    int size = 0;
-    for (int i = 0; i < IDLE_FRAMES; i++)
+// Decode cycles of a frame, codec ID then payload
+long frame_cycles(const unsigned char *frame, size_t n)
+{
+    const unsigned char *end = frame + n;
+    const unsigned char *data = frame + 1;
+    long cycles = CYCLES_ITEM + CYCLES_READ;
+
+    switch (frame[0])
+    {
+    case OLED_CODEC_RAW:
+        return cycles + (n - 1) * (CYCLES_READ + CYCLES_BYTE);
+    case OLED_CODEC_RLE:
+    case OLED_CODEC_DELTA:
+        while (data < end)
+        {
+            unsigned char count = *data++;
+            cycles += CYCLES_ITEM + CYCLES_READ;
+            if (count & 0x80)
+            {
+                count &= ~(0x80);
+                cycles += count * (CYCLES_READ + CYCLES_BYTE);
+                data += count;
+            }
+            else
+            {
+                cycles += CYCLES_READ + (frame[0] == OLED_CODEC_RLE || *data ? count * CYCLES_BYTE : 0);
+                data++;
+            }
+        }
+        return cycles;
+    case OLED_CODEC_LZ:
     {
-        size = max(size, rle_encode(output, idle[i], ANIM_SIZE));
+        const int length_bits = 16 - *data++;
+        int items = 0;
+        unsigned char flags = 0;
+        cycles += CYCLES_READ;
+        while (data < end)
+        {
+            if (!items)
+            {
+                flags = *data++;
+                items = 8;
+                cycles += CYCLES_READ;
+            }
+            if (flags & 1)
+            {
+                cycles += CYCLES_ITEM + CYCLES_READ + CYCLES_BYTE;
+                data++;
+            }
+            else
+            {
+                unsigned match = data[0] | data[1] << 8;
+                cycles += CYCLES_ITEM + 2 * CYCLES_READ +
+                          ((match & ((1u << length_bits) - 1)) + OLED_LZ_MIN_MATCH) * CYCLES_BYTE;
+                data += 2;
+            }
+            flags >>= 1;
+            items--;
+        }
+        return cycles;
     }
+    }
+    return cycles;
+}
+
+// Encode one frame with the smallest allowed codec and LZ window that
+// decodes within ceiling cycles, 0 for no ceiling. Raw is always a
+// fallback and frame 0 is never a delta.
+static size_t frame_encode(unsigned char *output, const unsigned char *frame, const unsigned char *previous, int codecs,
+                           long ceiling)
+{
+    unsigned char candidate[2 * MAX_FRAME_SIZE + 1];
+    size_t size = frame_size + 1;
+    long cycles;
+
+    output[0] = OLED_CODEC_RAW;
+    memcpy(output + 1, frame, frame_size);
+    cycles = frame_cycles(output, size);
+
+    for (int codec = OLED_CODEC_RLE; codec <= OLED_CODEC_LZ; codec++)
+    {
+        if (!(codecs & CODEC_BIT(codec)) || (codec == OLED_CODEC_DELTA && !previous))
+            continue;
+
+        // Every LZ window is a candidate of its own
+        for (int window_bits = 5; window_bits <= (codec == OLED_CODEC_LZ ? 12 : 5); window_bits++)
+        {
+            size_t n;
+            if (codec == OLED_CODEC_RLE)
+                n = rle_encode(candidate + 1, frame, frame_size);
+            else if (codec == OLED_CODEC_DELTA)
+                n = delta_encode(candidate + 1, frame, previous, frame_size);
+            else
+                n = lz_encode_window(candidate + 1, frame, frame_size, window_bits);
+            candidate[0] = codec;
+
+            // Smallest first, then fewest cycles
+            long const candidate_cycles = frame_cycles(candidate, n + 1);
+            if ((!ceiling || candidate_cycles <= ceiling) &&
+                (n + 1 < size || (n + 1 == size && candidate_cycles < cycles)))
+            {
+                memcpy(output, candidate, n + 1);
+                size = n + 1;
+                cycles = candidate_cycles;
+            }
+        }
+    }
+    return size;
+}
+
+// Encode frame i of an animation, returns the frame length
+static size_t anim_frame_encode(unsigned char *output, const animation_t *anim, int i)
+{
+    use_animation(anim);
+    return frame_encode(output, anim->frames[i], i ? anim->frames[i - 1] : NULL, anim->codecs, anim->ceiling);
+}
+
+// Build an "oled-codec.h" container from frames already encoded by
+// anim_frame_encode(), returns the container length
+static size_t anim_assemble(unsigned char *output, const animation_t *anim, unsigned char *const *frames,
+                            const size_t *sizes, report_t *report)
+{
+    size_t size = OLED_ANIM_HEADER + 2 * (anim->count + 1);
+
+    use_animation(anim);
+    output[0] = OLED_ANIM_VERSION;
+    output[1] = anim->count;
+    output[2] = rotate ? frame_height : 0;
+    for (int i = 0; i < anim->count; i++)
+    {
+        put_word(output + OLED_ANIM_HEADER + 2 * i, size);
+        memcpy(output + size, frames[i], sizes[i]);
+        report->codecs[output[size]]++;
+        size += sizes[i];
+    }
+    put_word(output + OLED_ANIM_HEADER + 2 * anim->count, size);
+
+    report->raw = frame_size * anim->count;
+    report->packed = size;
+    return size;
+}
+
+// Build an "oled-codec.h" container, returns the container length
+size_t anim_encode(unsigned char *output, const animation_t *anim, report_t *report)
+{
+    static _Thread_local unsigned char frames[MAX_FRAMES][2 * MAX_FRAME_SIZE + 1];
+    unsigned char *pointers[MAX_FRAMES];
+    size_t sizes[MAX_FRAMES];
+
+    for (int i = 0; i < anim->count; i++)
+    {
+        pointers[i] = frames[i];
+        sizes[i] = anim_frame_encode(frames[i], anim, i);
+    }
+    return anim_assemble(output, anim, pointers, sizes, report);
+}
+
+// Print data bytes, wrapping 16 bytes per line
+void print_array(FILE *out, const unsigned char *array, size_t n)
+{
+    for (size_t i = 0; i < n; i++)
+    {
+        fprintf(out, "%s0x%02x%s", i % 16 ? " " : "\n    ", array[i], i < n - 1 ? "," : "");
+    }
+}
+
+// Print an animation container, one line group per frame
+void print_container(FILE *out, const char *name, const unsigned char *container, int count, size_t size)
+{
+    const unsigned char *offsets = container + OLED_ANIM_HEADER;
+
+    fprintf(out, "static unsigned char const %s[] PROGMEM = {\n", name);
+    fprintf(out, "    // Version, frames, page width and offsets");
+    print_array(out, container, OLED_ANIM_HEADER + 2 * (count + 1));
+    for (int i = 0; i < count; i++)
+    {
+        size_t start = offsets[2 * i] | offsets[2 * i + 1] << 8;
+        size_t end = offsets[2 * i + 2] | offsets[2 * i + 3] << 8;
+        fprintf(out, ",\n    // Frame %d, %s", i, codec_names[container[start]]);
+        print_array(out, container + start, end - start);
+    }
+    fprintf(out, "};\n");
+    fprintf(out, "_Static_assert(sizeof(%s) == %zu, \"%s does not match its offset table\");\n\n", name, size, name);
+}
+
+// Parse name=image[@frame,...] into an animation in playback order
+static int load_animation(const char *spec, animation_t *anim)
+{
+    const char *equals = strchr(spec, '=');
+    if (!equals || equals == spec)
+    {
+        fprintf(stderr, "%s: expected name=image[@frame,...]\n", spec);
+        return -1;
+    }
+    snprintf(anim->name, sizeof(anim->name), "%.*s", (int)(equals - spec), spec);
+    snprintf(anim->source, sizeof(anim->source), "%s", equals + 1);
+    char *at = strchr(anim->source, '@');
+    if (at)
+        *at++ = '\0';
+
+    image_t image;
+    if (image_load(anim->source, &image))
+        return -1;
+    int frames = image_frames(&image, frame_width, frame_height);
+    if (!frames)
+    {
+        fprintf(stderr, "%s: smaller than a %dx%d frame\n", anim->source, frame_width, frame_height);
+        image_free(&image);
+        return -1;
+    }
+
+    anim->count = 0;
+    if (!at)
+    {
+        // Whole sheet in order
+        while (anim->count < frames && anim->count < MAX_FRAMES)
+        {
+            image_frame(&image, anim->count, frame_width, frame_height, anim->frames[anim->count]);
+            anim->count++;
+        }
+    }
+    while (at && anim->count < MAX_FRAMES)
+    {
+        char *end;
+        int index = strtol(at, &end, 10);
+        if (end == at || index < 0 || index >= frames)
+        {
+            fprintf(stderr, "%s: bad frame list at '%s'\n", spec, at);
+            image_free(&image);
+            return -1;
+        }
+        image_frame(&image, index, frame_width, frame_height, anim->frames[anim->count++]);
+        at = *end == ',' ? end + 1 : NULL;
+    }
+    image_free(&image);
 
-    printf("static const unsigned char PROGMEM idle[IDLE_FRAMES][%d] = {", size);
-    for (int i = 0; i < IDLE_FRAMES; i++)
+    anim->width = frame_width;
+    anim->height = frame_height;
+    anim->rotate = rotate;
+    if (rotate && (frame_width % 8 || frame_height > 255))
     {
-        if (i != 0)
-            printf(",\n");
-        int n = rle_encode(output, idle[i], ANIM_SIZE);
-        print_array(output, n);
+        fprintf(stderr, "%s: rotated frames need a width multiple of 8 and height under 256\n", spec);
+        return -1;
     }
-    printf("};\n");
-    size = rle_encode(output, prep[0], ANIM_SIZE);
-    printf("static const unsigned char PROGMEM prep[][%d] = {", size);
-    print_array(output, size);
-    printf("};\n");
-    size = 0;
-    for (int i = 0; i < TAP_FRAMES; i++)
+    for (int i = 0; rotate && i < anim->count; i++)
     {
-        size = max(size, rle_encode(output, tap[i], ANIM_SIZE));
+        unsigned char frame[MAX_FRAME_SIZE];
+        rotate_frame(frame, anim->frames[i]);
+        memcpy(anim->frames[i], frame, frame_size);
     }
-    printf("static const unsigned char PROGMEM tap[TAP_FRAMES][%d] = {", size);
-    for (int i = 0; i < TAP_FRAMES; i++)
+    return 0;
+}
+
+#ifndef RLE_NO_MAIN
+#include <pthread.h>
+
+// One frame to encode on a worker thread
+typedef struct
+{
+    const animation_t *anim;
+    int frame;
+    size_t size;
+    unsigned char output[2 * MAX_FRAME_SIZE + 1];
+} job_t;
+
+static job_t *jobs;
+static int job_count;
+static atomic_int next_job;
+
+// Encode frames until none are left. Each frame only depends on its
+// animation, so results do not depend on the number of threads.
+static void *encode_jobs(void *unused)
+{
+    (void)unused;
+    for (int j; (j = atomic_fetch_add(&next_job, 1)) < job_count;)
     {
-        if (i != 0)
-            printf(",\n");
-        int n = rle_encode(output, tap[i], ANIM_SIZE);
-        print_array(output, n);
+        jobs[j].size = anim_frame_encode(jobs[j].output, jobs[j].anim, jobs[j].frame);
     }
-    printf("};\n");
-}
\ No newline at end of file
+    return NULL;
+}
+
+// Encode every frame of every animation on threads workers
+static int encode_all(const animation_t *anims, int count, int threads)
+{
+    pthread_t workers[64];
+
+    job_count = 0;
+    for (int i = 0; i < count; i++)
+        job_count += anims[i].count;
+    jobs = malloc(job_count * sizeof(job_t));
+    if (!jobs)
+    {
+        perror("rle");
+        return 1;
+    }
+    for (int i = 0, j = 0; i < count; i++)
+    {
+        for (int f = 0; f < anims[i].count; f++, j++)
+        {
+            jobs[j].anim = &anims[i];
+            jobs[j].frame = f;
+        }
+    }
+
+    atomic_store(&next_job, 0);
+    threads = threads < 1 ? 1 : threads > 64 ? 64 : threads;
+    int started = 1;
+    for (; started < threads && !pthread_create(&workers[started], NULL, encode_jobs, NULL); started++)
+        ;
+    encode_jobs(NULL);
+    for (int t = 1; t < started; t++)
+        pthread_join(workers[t], NULL);
+    return 0;
+}
+// Comma separated codec names to a CODEC_BIT mask, -1 if unknown
+static int parse_codecs(const char *list)
+{
+    int mask = 0;
+    while (*list)
+    {
+        size_t n = strcspn(list, ",");
+        int codec = OLED_CODEC_LZ;
+        while (codec >= 0 && (strlen(codec_names[codec]) != n || strncmp(list, codec_names[codec], n)))
+            codec--;
+        if (codec < 0)
+            return -1;
+        mask |= CODEC_BIT(codec);
+        list += n + (list[n] == ',');
+    }
+    return mask;
+}
+
+int main(int argc, char *argv[])
+{
+    static animation_t anims[MAX_ANIMATIONS];
+    static unsigned char output[0x10000];
+    FILE *out = stdout;
+    long budget = 0;
+    static size_t layout_sizes[MAX_ANIMATIONS][RLE_LAYOUTS + 1];
+    FILE *manifest = NULL;
+    int mirror = 0;
+    int experiment = 0;
+    int threads = sysconf(_SC_NPROCESSORS_ONLN);
+    int codecs = CODECS_ALL;
+    long ceiling = 0;
+    int count = 0;
+    int opt;
+
+    // Options apply to the assets after them, so each asset can pick its
+    // size, rotation and codecs
+    while (optind < argc)
+    {
+        if ((opt = getopt(argc, argv, "+s:rlb:o:c:d:j:m:x")) == -1)
+        {
+            if (count + 1 + mirror > MAX_ANIMATIONS || load_animation(argv[optind++], &anims[count]))
+                return 1;
+            anims[count].codecs = codecs;
+            anims[count].ceiling = ceiling;
+            if (mirror)
+            {
+                animation_t *left = &anims[count + 1];
+                char name[sizeof(left->name)];
+                *left = anims[count];
+                // Copied first, the name buffers are elements of one array
+                memcpy(name, anims[count].name, sizeof(name));
+                snprintf(left->name, sizeof(left->name), "left_%.58s", name);
+                for (int f = 0; f < left->count; f++)
+                    mirror_frame(left->frames[f], anims[count].frames[f], frame_size);
+            }
+            count += 1 + mirror;
+            continue;
+        }
+
+        switch (opt)
+        {
+        case 's':
+            if (sscanf(optarg, "%dx%d", &frame_width, &frame_height) != 2 || frame_width <= 0 ||
+                frame_height <= 0 || frame_height % 8 || frame_width * frame_height / 8 > MAX_FRAME_SIZE)
+            {
+                fprintf(stderr, "-s %s: expected WxH with height a multiple of 8\n", optarg);
+                return 1;
+            }
+            frame_size = frame_width * frame_height / 8;
+            break;
+        case 'r':
+            rotate = 1;
+            break;
+        case 'l':
+            mirror = 1;
+            break;
+        case 'b':
+            budget = atol(optarg);
+            break;
+        case 'd':
+            ceiling = atol(optarg);
+            break;
+        case 'j':
+            threads = atoi(optarg);
+            break;
+        case 'm':
+            manifest = fopen(optarg, "w");
+            if (!manifest)
+            {
+                perror(optarg);
+                return 1;
+            }
+            break;
+        case 'x':
+            experiment = 1;
+            break;
+        case 'c':
+            if ((codecs = parse_codecs(optarg)) < 0)
+            {
+                fprintf(stderr, "-c %s: expected a list of raw,rle,delta,lz\n", optarg);
+                return 1;
+            }
+            break;
+        case 'o':
+            out = fopen(optarg, "w");
+            if (!out)
+            {
+                perror(optarg);
+                return 1;
+            }
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-s WxH] [-r] [-l] [-c codec,...] [-d cycles] [-b budget] [-j threads] [-x] [-m manifest] "
+                    "[-o header] name=image[@frame,...] ...\n",
+                    argv[0]);
+            return 1;
+        }
+    }
+
+    if (encode_all(anims, count, threads))
+        return 1;
+    // A broken encoder must not ship a corrupt header
+    if (atomic_load(&decode_errors))
+    {
+        fprintf(stderr, "%d frames do not decode back to their source\n", atomic_load(&decode_errors));
+        return 1;
+    }
+
+    fprintf(out, "// Generated by \"rle.c\", do not edit. Regenerate with:\n//");
+    for (int i = 0; i < argc; i++)
+        fprintf(out, " %s", i ? argv[i] : "./rle");
+    fprintf(out, "\n\n#pragma once\n\n");
+    if (manifest)
+    {
+        fprintf(manifest, "# Generated by \"rle.c\", frame choices of the header. Regenerate with:\n#");
+        for (int i = 0; i < argc; i++)
+            fprintf(manifest, " %s", i ? argv[i] : "./rle");
+        fprintf(manifest, "\n# asset frame codec window bytes cycles\n");
+    }
+
+
+    size_t total = 0;
+    size_t total_raw = 0;
+    fprintf(stderr, "%-16s %6s %7s %7s %6s %7s  %s\n", "asset", "frames", "raw", "packed", "ratio", "cycles",
+            "raw/rle/delta/lz");
+    for (int i = 0, j = 0; i < count; j += anims[i++].count)
+    {
+        report_t report = {0};
+        unsigned char *frames[MAX_FRAMES];
+        size_t sizes[MAX_FRAMES];
+        long worst = 0;
+        for (int f = 0; f < anims[i].count; f++)
+        {
+            const job_t *job = &jobs[j + f];
+            long cycles = frame_cycles(job->output, job->size);
+            frames[f] = jobs[j + f].output;
+            sizes[f] = job->size;
+            worst = cycles > worst ? cycles : worst;
+            if (manifest && job->output[0] == OLED_CODEC_LZ)
+                fprintf(manifest, "%s %d lz %d %zu %ld\n", anims[i].name, f, job->output[1], job->size, cycles);
+            else if (manifest)
+                fprintf(manifest, "%s %d %s - %zu %ld\n", anims[i].name, f, codec_names[job->output[0]], job->size,
+                        cycles);
+        }
+
+        size_t size = anim_assemble(output, &anims[i], frames, sizes, &report);
+        if (size > 0xffff)
+        {
+            fprintf(stderr, "%s: container of %zu bytes exceeds 16-bit offsets\n", anims[i].name, size);
+            return 1;
+        }
+        print_container(out, anims[i].name, output, anims[i].count, size);
+        fprintf(stderr, "%-16s %6d %7zu %7zu %5.1f%% %7ld  %d/%d/%d/%d\n", anims[i].name, anims[i].count, report.raw,
+                report.packed, 100.0 * report.packed / report.raw, worst, report.codecs[0], report.codecs[1],
+                report.codecs[2], report.codecs[3]);
+        total += size;
+        total_raw += report.raw;
+
+        // Containers are re-encoded per layout, frames may change codec
+        for (int l = 0; experiment && l <= RLE_LAYOUTS; l++)
+        {
+            static unsigned char scratch[0x10000];
+            report_t ignored = {0};
+            rle_greedy = !l;
+            rle_layout = l ? l - 1 : RLE_CLASSIC;
+            layout_sizes[i][l] = anim_encode(scratch, &anims[i], &ignored);
+        }
+        rle_greedy = 0;
+        rle_layout = RLE_CLASSIC;
+    }
+    fprintf(stderr, "%-16s %6s %7zu %7zu %5.1f%%\n", "total", "", total_raw, total, total_raw ? 100.0 * total / total_raw : 0);
+
+    if (experiment)
+    {
+        size_t totals[RLE_LAYOUTS + 1] = {0};
+        fprintf(stderr, "\n%-16s %8s", "asset", "greedy");
+        for (int l = 0; l < RLE_LAYOUTS; l++)
+            fprintf(stderr, " %8s", rle_layouts[l].name);
+        fprintf(stderr, "\n");
+        for (int i = 0; i <= count; i++)
+        {
+            fprintf(stderr, "%-16s", i < count ? anims[i].name : "total");
+            for (int l = 0; l <= RLE_LAYOUTS; l++)
+            {
+                totals[l] += i < count ? layout_sizes[i][l] : 0;
+                fprintf(stderr, " %8zu", i < count ? layout_sizes[i][l] : totals[l]);
+            }
+            fprintf(stderr, "\n");
+        }
+        fprintf(stderr, "%-16s %8s", "saved", "");
+        for (int l = 0; l < RLE_LAYOUTS; l++)
+            fprintf(stderr, " %8ld", (long)totals[0] - (long)totals[l + 1]);
+        fprintf(stderr, "\n");
+    }
+
+    if (budget)
+    {
+        fprintf(out, "_Static_assert(");
+        for (int i = 0; i < count; i++)
+            fprintf(out, "%ssizeof(%s)", i ? " + " : "", anims[i].name);
+        fprintf(out, " <= %ld, \"OLED assets exceed the %ld byte flash budget\");\n", budget, budget);
+    }
+
+    if (out != stdout)
+        fclose(out);
+    if (manifest)
+        fclose(manifest);
+    free(jobs);
+    if (atomic_load(&decode_errors))
+    {
+        fprintf(stderr, "%d frames do not decode back to their source\n", atomic_load(&decode_errors));
+        return 1;
+    }
+    if (budget && total > (size_t)budget)
+    {
+        fprintf(stderr, "Assets use %zu bytes, over the %ld byte budget\n", total, budget);
+        return 1;
+    }
+    return 0;
+}
+#endif
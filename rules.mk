@@ -1,7 +1,17 @@
-WPM_ENABLE = yes
-
 OLED_ENABLE = yes
 OLED_DRIVER = SSD1306
 
 SRC += ethanharstad.c
-SRC += oled/oled-bongocat.c oled/oled-icons.c
+SRC += keymap/keymap-sparse.c
+SRC += oled/oled-bongocat.c oled/oled-sprite.c oled/oled-codec.c oled/oled-icons.c
+SRC += oled/oled-typing.c
+SRC += oled/oled-sync.c
+SRC += oled/oled-profile.c
+
+# Generated keymap headers stop the build when ethanharstad.json changed
+# since, see keymap/sparse.c
+KEYMAP_JSON_CKSUM := $(firstword $(shell cksum < $(USER_PATH)/ethanharstad.json))
+ifeq ($(KEYMAP_JSON_CKSUM),)
+    $(error Could not checksum $(USER_PATH)/ethanharstad.json)
+endif
+OPT_DEFS += -DKEYMAP_JSON_CKSUM=$(KEYMAP_JSON_CKSUM)